@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Components/Board.h"
+#include "TicTacToeState/TicTacToeState.h"
+
+#include <array>
+
+// Fixed positions used by the benchmarks. Each is a legal position with the game still in progress.
+namespace Positions
+{
+// Names of the positions, for labeling the results
+inline constexpr char const * NAMES[] = { "empty", "opening", "middle", "ending" };
+
+// Number of positions
+inline constexpr int COUNT = 4;
+
+// Returns the position with the specified index
+inline TicTacToeState get(int index)
+{
+    using C = Board::Cell;
+    static std::array<Board::Cell, 9> const CELLS[COUNT] = {
+        { C::NEITHER, C::NEITHER, C::NEITHER, C::NEITHER, C::NEITHER, C::NEITHER, C::NEITHER, C::NEITHER, C::NEITHER },
+        { C::NEITHER, C::NEITHER, C::NEITHER, C::NEITHER, C::X, C::NEITHER, C::NEITHER, C::NEITHER, C::NEITHER },
+        { C::X, C::NEITHER, C::NEITHER, C::NEITHER, C::O, C::NEITHER, C::NEITHER, C::NEITHER, C::X },
+        { C::X, C::O, C::X, C::NEITHER, C::O, C::NEITHER, C::NEITHER, C::X, C::NEITHER }
+    };
+    static TicTacToeState::PlayerId const TURNS[COUNT] = {
+        TicTacToeState::PlayerId::ALICE, TicTacToeState::PlayerId::BOB, TicTacToeState::PlayerId::BOB,
+        TicTacToeState::PlayerId::BOB
+    };
+    return TicTacToeState(Board(CELLS[index]), TURNS[index]);
+}
+} // namespace Positions
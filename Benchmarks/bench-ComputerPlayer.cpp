@@ -0,0 +1,72 @@
+#include "Positions.h"
+
+#include "ComputerPlayer/ComputerPlayer.h"
+#include "GamePlayer/GameState.h"
+#include "TicTacToeState/TicTacToeState.h"
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+// Generating and freeing the responses to a state
+static void BM_ComputerPlayer_responseGenerator(benchmark::State & bench)
+{
+    TicTacToeState const state = Positions::get(static_cast<int>(bench.range(0)));
+    ComputerPlayer       player(state.whoseTurn());
+    for (auto _ : bench)
+    {
+        std::vector<GamePlayer::GameState *> responses = player.responseGenerator(state, 1);
+        benchmark::DoNotOptimize(responses.data());
+        for (GamePlayer::GameState * pResponse : responses)
+        {
+            delete pResponse;
+        }
+    }
+    bench.SetLabel(Positions::NAMES[bench.range(0)]);
+}
+BENCHMARK(BM_ComputerPlayer_responseGenerator)->DenseRange(0, Positions::COUNT - 1);
+
+// Choosing a move. The first argument is the position and the second is the engine. The player is reused, so its
+// transposition table is warm after the first iteration, as it is during a game.
+static void BM_ComputerPlayer_move(benchmark::State & bench)
+{
+    TicTacToeState const    state = Positions::get(static_cast<int>(bench.range(0)));
+    ComputerPlayer::Options options;
+    options.engine = static_cast<ComputerPlayer::Options::Engine>(bench.range(1));
+    ComputerPlayer player(state.whoseTurn(), options);
+    for (auto _ : bench)
+    {
+        TicTacToeState copy(state);
+        player.move(&copy);
+        benchmark::DoNotOptimize(copy);
+    }
+    bench.SetLabel(std::string(Positions::NAMES[bench.range(0)]) +
+                   ((options.engine == ComputerPlayer::Options::Engine::NEGAMAX) ? "/negamax" : "/game tree"));
+}
+BENCHMARK(BM_ComputerPlayer_move)
+    ->ArgsProduct({ benchmark::CreateDenseRange(0, Positions::COUNT - 1, 1),
+                    { static_cast<int>(ComputerPlayer::Options::Engine::GAME_TREE),
+                      static_cast<int>(ComputerPlayer::Options::Engine::NEGAMAX) } })
+    ->Unit(benchmark::kMicrosecond);
+
+// Choosing a move with a new player each time, so nothing is cached
+static void BM_ComputerPlayer_moveCold(benchmark::State & bench)
+{
+    TicTacToeState const    state = Positions::get(static_cast<int>(bench.range(0)));
+    ComputerPlayer::Options options;
+    options.engine = static_cast<ComputerPlayer::Options::Engine>(bench.range(1));
+    for (auto _ : bench)
+    {
+        ComputerPlayer player(state.whoseTurn(), options);
+        TicTacToeState copy(state);
+        player.move(&copy);
+        benchmark::DoNotOptimize(copy);
+    }
+    bench.SetLabel(std::string(Positions::NAMES[bench.range(0)]) +
+                   ((options.engine == ComputerPlayer::Options::Engine::NEGAMAX) ? "/negamax" : "/game tree"));
+}
+BENCHMARK(BM_ComputerPlayer_moveCold)
+    ->ArgsProduct({ benchmark::CreateDenseRange(0, Positions::COUNT - 1, 1),
+                    { static_cast<int>(ComputerPlayer::Options::Engine::GAME_TREE),
+                      static_cast<int>(ComputerPlayer::Options::Engine::NEGAMAX) } })
+    ->Unit(benchmark::kMicrosecond);
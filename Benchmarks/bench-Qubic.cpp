@@ -0,0 +1,94 @@
+#include "ComputerPlayer/QubicEvaluator.h"
+#include "ComputerPlayer/QubicResponseGenerator.h"
+#include "GamePlayer/GameState.h"
+#include "GamePlayer/GameTree.h"
+#include "GamePlayer/TranspositionTable.h"
+#include "TicTacToeState/QubicState.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+// A position after a few moves of each player, with no threats, so every empty cell is a response
+static QubicState opening()
+{
+    QubicState state;
+    state.move(0, 0, 0); // X
+    state.move(1, 1, 1); // O
+    state.move(3, 3, 3); // X
+    state.move(2, 2, 2); // O
+    state.move(0, 3, 0); // X
+    state.move(3, 0, 3); // O
+    return state;
+}
+
+// Making and unmaking each legal move
+static void BM_QubicState_move(benchmark::State & bench)
+{
+    QubicState           state = opening();
+    QubicState::MoveList moves;
+    state.generateMoves(&moves);
+    for (auto _ : bench)
+    {
+        for (auto const & move : moves)
+        {
+            state.move(move.index);
+            benchmark::DoNotOptimize(state.isDone());
+            state.unmove();
+        }
+    }
+    bench.SetItemsProcessed(bench.iterations() * moves.size());
+}
+BENCHMARK(BM_QubicState_move);
+
+// Evaluating a state
+static void BM_QubicEvaluator_evaluate(benchmark::State & bench)
+{
+    QubicState const state = opening();
+    QubicEvaluator   evaluator;
+    for (auto _ : bench)
+    {
+        benchmark::DoNotOptimize(evaluator.evaluate(state));
+    }
+}
+BENCHMARK(BM_QubicEvaluator_evaluate);
+
+// Generating, ordering and freeing the responses to a state
+static void BM_QubicResponseGenerator(benchmark::State & bench)
+{
+    QubicState const       state = opening();
+    QubicResponseGenerator generator;
+    for (auto _ : bench)
+    {
+        std::vector<GamePlayer::GameState *> responses = generator(state, 1);
+        benchmark::DoNotOptimize(responses.data());
+        for (GamePlayer::GameState * pResponse : responses)
+        {
+            delete pResponse;
+        }
+    }
+    bench.SetItemsProcessed(static_cast<int64_t>(generator.generatedStates()));
+}
+BENCHMARK(BM_QubicResponseGenerator);
+
+// Searching the game tree to the depth given by the argument, with a new tree each time. The number of states generated
+// per second shows how the search scales with the branching factor.
+static void BM_QubicGameTree(benchmark::State & bench)
+{
+    QubicState const       state = opening();
+    int const              depth = static_cast<int>(bench.range(0));
+    QubicResponseGenerator generator;
+    for (auto _ : bench)
+    {
+        GamePlayer::GameTree tree(std::make_shared<GamePlayer::TranspositionTable>(1 << 20, depth),
+                                  std::make_shared<QubicEvaluator>(),
+                                  [&generator] (GamePlayer::GameState const & s, int d) { return generator(s, d); },
+                                  depth);
+        auto pState = std::make_shared<QubicState>(state);
+        tree.findBestResponse(pState);
+        benchmark::DoNotOptimize(pState->response_);
+    }
+    bench.SetItemsProcessed(static_cast<int64_t>(generator.generatedStates()));
+}
+BENCHMARK(BM_QubicGameTree)->DenseRange(1, 3)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,41 @@
+#include "Positions.h"
+
+#include "ComputerPlayer/TicTacToeEvaluator.h"
+#include "GamePlayer/GameState.h"
+#include "TicTacToeState/TicTacToeState.h"
+
+#include <benchmark/benchmark.h>
+
+// Evaluating through the virtual StaticEvaluator interface, as the game tree does. The argument is the mode.
+static void BM_TicTacToeEvaluator_evaluate(benchmark::State & bench)
+{
+    auto                                mode  = static_cast<TicTacToeEvaluator::Mode>(bench.range(0));
+    TicTacToeEvaluator                  evaluator(mode);
+    GamePlayer::StaticEvaluator const & base = evaluator;
+    TicTacToeState const                state = Positions::get(2);
+    GamePlayer::GameState const &       gameState = state;
+    for (auto _ : bench)
+    {
+        benchmark::DoNotOptimize(base.evaluate(gameState));
+    }
+    bench.SetLabel((mode == TicTacToeEvaluator::Mode::TABLE) ? "table" : "heuristic");
+}
+BENCHMARK(BM_TicTacToeEvaluator_evaluate)
+    ->Arg(static_cast<int>(TicTacToeEvaluator::Mode::HEURISTIC))
+    ->Arg(static_cast<int>(TicTacToeEvaluator::Mode::TABLE));
+
+// Evaluating through the non-virtual overload, as the negamax search does. The argument is the mode.
+static void BM_TicTacToeEvaluator_evaluateDirect(benchmark::State & bench)
+{
+    auto                 mode = static_cast<TicTacToeEvaluator::Mode>(bench.range(0));
+    TicTacToeEvaluator   evaluator(mode);
+    TicTacToeState const state = Positions::get(2);
+    for (auto _ : bench)
+    {
+        benchmark::DoNotOptimize(evaluator.evaluate(state));
+    }
+    bench.SetLabel((mode == TicTacToeEvaluator::Mode::TABLE) ? "table" : "heuristic");
+}
+BENCHMARK(BM_TicTacToeEvaluator_evaluateDirect)
+    ->Arg(static_cast<int>(TicTacToeEvaluator::Mode::HEURISTIC))
+    ->Arg(static_cast<int>(TicTacToeEvaluator::Mode::TABLE));
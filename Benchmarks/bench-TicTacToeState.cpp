@@ -0,0 +1,73 @@
+#include "Positions.h"
+
+#include "Components/Board.h"
+#include "TicTacToeState/TicTacToeState.h"
+
+#include <benchmark/benchmark.h>
+
+// Making and unmaking each legal move
+static void BM_TicTacToeState_move(benchmark::State & bench)
+{
+    TicTacToeState           state = Positions::get(static_cast<int>(bench.range(0)));
+    TicTacToeState::MoveList moves;
+    state.generateMoves(&moves);
+    for (auto _ : bench)
+    {
+        for (auto const & move : moves)
+        {
+            state.move(move.row, move.column);
+            benchmark::DoNotOptimize(state.isDone());
+            state.unmove();
+        }
+    }
+    bench.SetItemsProcessed(bench.iterations() * moves.size());
+    bench.SetLabel(Positions::NAMES[bench.range(0)]);
+}
+BENCHMARK(BM_TicTacToeState_move)->DenseRange(0, Positions::COUNT - 1);
+
+// Moving on a copy of the state, as the game tree does
+static void BM_TicTacToeState_copyAndMove(benchmark::State & bench)
+{
+    TicTacToeState const     state = Positions::get(static_cast<int>(bench.range(0)));
+    TicTacToeState::MoveList moves;
+    state.generateMoves(&moves);
+    for (auto _ : bench)
+    {
+        for (auto const & move : moves)
+        {
+            TicTacToeState child(state);
+            child.move(move.row, move.column);
+            benchmark::DoNotOptimize(child);
+        }
+    }
+    bench.SetItemsProcessed(bench.iterations() * moves.size());
+    bench.SetLabel(Positions::NAMES[bench.range(0)]);
+}
+BENCHMARK(BM_TicTacToeState_copyAndMove)->DenseRange(0, Positions::COUNT - 1);
+
+// Constructing a state from a board, which determines the game status from scratch with checkIfDone()
+static void BM_TicTacToeState_checkIfDone(benchmark::State & bench)
+{
+    Board const board = Positions::get(static_cast<int>(bench.range(0))).board();
+    for (auto _ : bench)
+    {
+        TicTacToeState state(board, TicTacToeState::PlayerId::ALICE);
+        benchmark::DoNotOptimize(state.isDone());
+    }
+    bench.SetLabel(Positions::NAMES[bench.range(0)]);
+}
+BENCHMARK(BM_TicTacToeState_checkIfDone)->DenseRange(0, Positions::COUNT - 1);
+
+// Generating the legal moves
+static void BM_TicTacToeState_generateMoves(benchmark::State & bench)
+{
+    TicTacToeState const     state = Positions::get(static_cast<int>(bench.range(0)));
+    TicTacToeState::MoveList moves;
+    for (auto _ : bench)
+    {
+        state.generateMoves(&moves);
+        benchmark::DoNotOptimize(moves);
+    }
+    bench.SetLabel(Positions::NAMES[bench.range(0)]);
+}
+BENCHMARK(BM_TicTacToeState_generateMoves)->DenseRange(0, Positions::COUNT - 1);
@@ -0,0 +1,60 @@
+#include "Components/Board.h"
+#include "TicTacToeState/ZHash.h"
+
+#include <benchmark/benchmark.h>
+
+// Adding a piece to each cell
+static void BM_ZHash_move(benchmark::State & bench)
+{
+    ZHash hash;
+    for (auto _ : bench)
+    {
+        for (int i = 0; i < 9; ++i)
+        {
+            hash.move((i & 1) ? Board::Cell::O : Board::Cell::X, i);
+        }
+        benchmark::DoNotOptimize(hash);
+    }
+    bench.SetItemsProcessed(bench.iterations() * 9);
+}
+BENCHMARK(BM_ZHash_move);
+
+// Changing whose turn it is
+static void BM_ZHash_turn(benchmark::State & bench)
+{
+    ZHash hash;
+    for (auto _ : bench)
+    {
+        hash.turn();
+        benchmark::DoNotOptimize(hash);
+    }
+}
+BENCHMARK(BM_ZHash_turn);
+
+// Marking the game as over, for each outcome
+static void BM_ZHash_done(benchmark::State & bench)
+{
+    ZHash hash;
+    for (auto _ : bench)
+    {
+        hash.done(Board::Cell::NEITHER);
+        hash.done(Board::Cell::X);
+        hash.done(Board::Cell::O);
+        benchmark::DoNotOptimize(hash);
+    }
+    bench.SetItemsProcessed(bench.iterations() * 3);
+}
+BENCHMARK(BM_ZHash_done);
+
+// Computing the hash of a board from scratch
+static void BM_ZHash_board(benchmark::State & bench)
+{
+    using C = Board::Cell;
+    Board const board({ C::X, C::O, C::X, C::NEITHER, C::O, C::NEITHER, C::NEITHER, C::X, C::NEITHER });
+    for (auto _ : bench)
+    {
+        ZHash hash(board, GamePlayer::GameState::PlayerId::BOB);
+        benchmark::DoNotOptimize(hash);
+    }
+}
+BENCHMARK(BM_ZHash_board);
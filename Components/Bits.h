@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cassert>
+#include <type_traits>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Operations on masks, the unsigned integers in which bit i corresponds to the cell at index i.
+//
+// Each operation compiles to a single instruction on the common processors. The boards, the states that keep their own
+// masks, and the tablebase solver all use these, whatever the size of their masks.
+namespace Bits
+{
+// Returns the index of the lowest cell in the mask. The mask must not be empty.
+template <typename Mask>
+int firstIndex(Mask mask)
+{
+    static_assert(std::is_unsigned_v<Mask> && sizeof(Mask) <= 8, "A mask is an unsigned integer of at most 64 bits");
+    assert(mask != 0);
+#if defined(_MSC_VER)
+    unsigned long index;
+    if constexpr (sizeof(Mask) <= 4)
+        _BitScanForward(&index, mask);
+    else
+        _BitScanForward64(&index, mask);
+    return static_cast<int>(index);
+#else
+    if constexpr (sizeof(Mask) <= 4)
+        return __builtin_ctz(mask);
+    else
+        return __builtin_ctzll(mask);
+#endif
+}
+
+// Returns the number of cells in the mask
+template <typename Mask>
+int count(Mask mask)
+{
+    static_assert(std::is_unsigned_v<Mask> && sizeof(Mask) <= 8, "A mask is an unsigned integer of at most 64 bits");
+#if defined(_MSC_VER)
+    if constexpr (sizeof(Mask) <= 2)
+        return static_cast<int>(__popcnt16(mask));
+    else if constexpr (sizeof(Mask) <= 4)
+        return static_cast<int>(__popcnt(mask));
+    else
+        return static_cast<int>(__popcnt64(mask));
+#else
+    if constexpr (sizeof(Mask) <= 4)
+        return __builtin_popcount(mask);
+    else
+        return __builtin_popcountll(mask);
+#endif
+}
+} // namespace Bits
@@ -1,45 +1,269 @@
 #pragma once
 
+#include "Bits.h"
+#include "Tables.h"
+
 #include <array>
+#include <cassert>
 #include <cstdint>
 #include <utility>
 
-class Board
+// Cell values on a board. They are the same for boards of every size.
+enum class BoardCell : uint8_t
 {
+    NEITHER = 0,
+    X       = 1,
+    O       = 2
+};
+
+// A tic-tac-toe board with Rows rows and Columns columns, on which K marks in a line win.
+//
+// The board is stored as two bitboards, one for the Xs and one for the Os. Bit i of each mask corresponds to the cell at
+// index i (row-major order), so moves, queries and copies are just a few integer operations, and a win is a mask test
+// against the winning lines. The size is fixed at compile time, so the masks are the smallest integers that fit, and the
+// tables are generated for each size (see Tables::BasicTables). The 3x3 board is Board.
+template <int Rows, int Columns, int K>
+class BasicBoard
+{
+    using BoardTables = Tables::BasicTables<Rows, Columns, K>;
+
 public:
     // Cell values on the board
-    enum class Cell : uint8_t
-    {
-        NEITHER = 0,
-        X       = 1,
-        O       = 2
-    };
+    using Cell = BoardCell;
 
-    Board(std::array<Cell, 9> const & board = {})
-        : board_(board)
-    {
-    }
+    // A set of cells. Bit i corresponds to the cell at index i.
+    using Mask = typename BoardTables::Mask;
+
+    // Size of the board, and the number of marks in a line needed to win
+    static int constexpr ROWS        = Rows;
+    static int constexpr COLUMNS     = Columns;
+    static int constexpr LINE_LENGTH = K;
+    static int constexpr CELLS       = Rows * Columns;
+
+    // Mask of all of the cells
+    static Mask constexpr ALL = Mask(~uint64_t(0) >> (64 - CELLS));
+
+    // Number of winning lines
+    static int constexpr NUMBER_OF_LINES = static_cast<int>(BoardTables::LINES.size());
+
+    // Masks of the winning lines
+    static constexpr std::array<Mask, NUMBER_OF_LINES> const & LINES = BoardTables::LINES;
+
+    // The lines through a cell, as indexes into LINES
+    using LinesThrough = typename BoardTables::LinesThrough;
+
+    // The lines through each cell
+    static constexpr std::array<LinesThrough, CELLS> const & LINES_THROUGH = BoardTables::LINES_THROUGH;
+
+    // True if the board has ranks. The ranks of big boards do not fit in 64 bits.
+    static bool constexpr HAS_RANKS = BoardTables::HAS_RANKS;
+
+    // Type of a rank
+    using Rank = typename BoardTables::Rank;
+
+    // Number of distinct boards (3^CELLS), if the board has ranks. Each board has a unique rank in the range
+    // [0, NUMBER_OF_RANKS).
+    static Rank constexpr NUMBER_OF_RANKS = HAS_RANKS ? BoardTables::POWERS_OF_3[CELLS - 1] * 3 : 0;
+
+    // Powers of 3. The rank of a board is the sum of the value of each cell times the power of 3 for its index.
+    static constexpr std::array<Rank, CELLS> const & POWERS_OF_3 = BoardTables::POWERS_OF_3;
+
+    // Number of symmetries of the board (the 4 rotations and 4 reflections of a square board, or the 2 rotations and 2
+    // reflections of any other)
+    static int constexpr NUMBER_OF_SYMMETRIES = static_cast<int>(BoardTables::SYMMETRIES.size());
 
-    std::array<Cell, 9> value() const { return board_; }
+    // For each symmetry, the index that each cell is moved to (see Tables::makeSymmetries())
+    static constexpr std::array<std::array<int8_t, CELLS>, NUMBER_OF_SYMMETRIES> const & SYMMETRIES = BoardTables::SYMMETRIES;
+
+    explicit BasicBoard(std::array<Cell, CELLS> const & board = {});
+
+    std::array<Cell, CELLS> value() const;
 
     // Returns the cell value at the specified position
-    Cell at(int row, int column) const { return board_[toIndex(row, column)]; }
+    Cell at(int row, int column) const { return at(toIndex(row, column)); }
 
     // Returns the cell value at the specified index
-    Cell at(int index) const;
+    Cell at(int index) const
+    {
+        assert(index >= 0 && index < CELLS);
+        Mask bit = Mask(Mask(1) << index);
+        return (x_ & bit) ? Cell::X : (o_ & bit) ? Cell::O : Cell::NEITHER;
+    }
 
     // Set the cell value at the specified position
-    void set(int row, int column, Cell value) { board_[toIndex(row, column)] = value; }
+    void set(int row, int column, Cell value) { set(toIndex(row, column), value); }
 
     // Set the cell value at the specified position
-    void set(int index, Cell value);
+    void set(int index, Cell value)
+    {
+        assert(index >= 0 && index < CELLS);
+        Mask bit = Mask(Mask(1) << index);
+        x_ = (value == Cell::X) ? Mask(x_ | bit) : Mask(x_ & ~bit);
+        o_ = (value == Cell::O) ? Mask(o_ | bit) : Mask(o_ & ~bit);
+    }
+
+    // Returns the mask of the cells with the specified value. For NEITHER, the mask of the empty cells is returned.
+    Mask mask(Cell cell) const { return (cell == Cell::X) ? x_ : (cell == Cell::O) ? o_ : emptyMask(); }
+
+    // Returns the mask of the empty cells
+    Mask emptyMask() const { return Mask(~(x_ | o_) & ALL); }
+
+    // Returns the rank of the board, which is the board read as a base-3 number with the value of cell i as digit i. The rank
+    // is a dense, collision-free index of the board. The board must have ranks.
+    Rank rank() const;
+
+    // Returns the board with the specified rank. The board must have ranks.
+    static BasicBoard unrank(Rank rank);
+
+    // Returns the amount that a cell with the specified value at the specified index contributes to the rank
+    static Rank rankOf(Cell cell, int index) { return static_cast<Rank>(static_cast<int>(cell) * POWERS_OF_3[index]); }
+
+    // Returns the board transformed by the specified symmetry
+    BasicBoard transformed(int symmetry) const;
+
+    // Returns the index that a cell is moved to by the specified symmetry
+    static int transform(int index, int symmetry)
+    {
+        assert(index >= 0 && index < CELLS);
+        assert(symmetry >= 0 && symmetry < NUMBER_OF_SYMMETRIES);
+        return SYMMETRIES[symmetry][index];
+    }
+
+    // Returns the symmetry that undoes the specified symmetry
+    static int inverse(int symmetry)
+    {
+        assert(symmetry >= 0 && symmetry < NUMBER_OF_SYMMETRIES);
+        // Only the 90 and 270 degree rotations of a square board are not self-inverse
+        if constexpr (Rows == Columns)
+            return (symmetry == 1) ? 3 : (symmetry == 3) ? 1 : symmetry;
+        else
+            return symmetry;
+    }
+
+    // Returns the value of the player with K in a line, or NEITHER if neither player has K in a line
+    Cell winner() const;
+
+    // Returns true if the mask contains a winning line
+    static bool hasLine(Mask mask)
+    {
+        for (Mask line : LINES)
+        {
+            if ((mask & line) == line)
+                return true;
+        }
+        return false;
+    }
+
+    // Returns the index of the lowest cell in the mask. The mask must not be empty.
+    static int firstIndex(Mask mask) { return Bits::firstIndex(mask); }
+
+    // Returns the number of cells in the mask
+    static int count(Mask mask) { return Bits::count(mask); }
+
+    // Returns the number of cells, as DynamicBoard::cells() does
+    static int cells() { return CELLS; }
 
     // Convert row/column to index
-    static int toIndex(int row, int column);
+    static int toIndex(int row, int column)
+    {
+        assert(row >= 0 && row < Rows && column >= 0 && column < Columns);
+        return row * Columns + column;
+    }
 
     // Convert index to row/column
-    static std::pair<int, int> toPosition(int index);
+    static std::pair<int, int> toPosition(int index)
+    {
+        assert(index >= 0 && index < CELLS);
+        return std::make_pair(index / Columns, index % Columns);
+    }
 
 private:
-    std::array<Cell, 9> board_; // 3x3 board stored in row-major order
+    Mask x_; // Cells marked with X
+    Mask o_; // Cells marked with O
 };
+
+// The 3x3 board
+using Board = BasicBoard<3, 3, 3>;
+
+template <int Rows, int Columns, int K>
+BasicBoard<Rows, Columns, K>::BasicBoard(std::array<Cell, CELLS> const & board)
+    : x_(0)
+    , o_(0)
+{
+    for (int i = 0; i < CELLS; ++i)
+    {
+        set(i, board[i]);
+    }
+}
+
+template <int Rows, int Columns, int K>
+auto BasicBoard<Rows, Columns, K>::value() const -> std::array<Cell, CELLS>
+{
+    std::array<Cell, CELLS> cells;
+    for (int i = 0; i < CELLS; ++i)
+    {
+        cells[i] = at(i);
+    }
+    return cells;
+}
+
+template <int Rows, int Columns, int K>
+auto BasicBoard<Rows, Columns, K>::rank() const -> Rank
+{
+    static_assert(HAS_RANKS, "The ranks of the board do not fit in 64 bits");
+    if constexpr (BoardTables::HAS_RANK_TABLE)
+    {
+        return static_cast<Rank>(BoardTables::RANKS[x_] + 2 * BoardTables::RANKS[o_]);
+    }
+    else
+    {
+        Rank rank = 0;
+        for (Mask x = x_; x != 0; x &= x - 1)
+        {
+            rank += POWERS_OF_3[firstIndex(x)];
+        }
+        for (Mask o = o_; o != 0; o &= o - 1)
+        {
+            rank += 2 * POWERS_OF_3[firstIndex(o)];
+        }
+        return rank;
+    }
+}
+
+template <int Rows, int Columns, int K>
+BasicBoard<Rows, Columns, K> BasicBoard<Rows, Columns, K>::unrank(Rank rank)
+{
+    static_assert(HAS_RANKS, "The ranks of the board do not fit in 64 bits");
+    assert(rank >= 0 && rank < NUMBER_OF_RANKS);
+    BasicBoard board;
+    for (int i = 0; i < CELLS; ++i)
+    {
+        board.set(i, static_cast<Cell>(rank % 3));
+        rank /= 3;
+    }
+    return board;
+}
+
+template <int Rows, int Columns, int K>
+BasicBoard<Rows, Columns, K> BasicBoard<Rows, Columns, K>::transformed(int symmetry) const
+{
+    BasicBoard board;
+    for (int i = 0; i < CELLS; ++i)
+    {
+        board.set(transform(i, symmetry), at(i));
+    }
+    return board;
+}
+
+template <int Rows, int Columns, int K>
+BoardCell BasicBoard<Rows, Columns, K>::winner() const
+{
+    if (hasLine(x_))
+        return Cell::X;
+    if (hasLine(o_))
+        return Cell::O;
+    return Cell::NEITHER;
+}
+
+// The 3x3 board is compiled once, in Board.cpp
+extern template class BasicBoard<3, 3, 3>;
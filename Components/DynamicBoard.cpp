@@ -0,0 +1,59 @@
+#include "DynamicBoard.h"
+
+#include "Tables.h"
+
+#include <stdexcept>
+#include <string>
+
+DynamicBoard::DynamicBoard(int rows, int columns, int k)
+    : geometry_(makeGeometry(rows, columns, k))
+    , cells_(rows * columns, Cell::NEITHER)
+{
+}
+
+BoardCell DynamicBoard::winner() const
+{
+    for (std::vector<int> const & line : geometry_->lines)
+    {
+        Cell first = cells_[line[0]];
+        if (first == Cell::NEITHER)
+            continue;
+        bool complete = true;
+        for (int index : line)
+        {
+            complete = complete && (cells_[index] == first);
+        }
+        if (complete)
+            return first;
+    }
+    return Cell::NEITHER;
+}
+
+std::shared_ptr<DynamicBoard::Geometry const> DynamicBoard::makeGeometry(int rows, int columns, int k)
+{
+    if (rows < 1 || rows > MAX_SIZE || columns < 1 || columns > MAX_SIZE || k < 1 || (k > rows && k > columns))
+    {
+        throw std::runtime_error("Invalid board: " + std::to_string(rows) + "x" + std::to_string(columns) + " with " +
+                                 std::to_string(k) + " in a line");
+    }
+
+    auto geometry     = std::make_shared<Geometry>();
+    geometry->rows    = rows;
+    geometry->columns = columns;
+    geometry->k       = k;
+    geometry->linesThrough.resize(rows * columns);
+
+    // The lines are in the same order as the lines of the compiled boards
+    Tables::forEachLine(rows, columns, k, [&geometry, k](int first, int step) {
+        std::vector<int> line;
+        for (int i = 0; i < k; ++i)
+        {
+            int index = first + i * step;
+            line.push_back(index);
+            geometry->linesThrough[index].push_back(static_cast<int>(geometry->lines.size()));
+        }
+        geometry->lines.push_back(std::move(line));
+    });
+
+    return geometry;
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "Board.h"
+
+#include <cassert>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// A tic-tac-toe board whose size and number of marks in a line needed to win are chosen at run time.
+//
+// It has the same interface as BasicBoard where that makes sense, but the cells are stored in a vector and the lines are
+// lists of cell indexes, so it is slower. It is used for sizes that do not have a compiled BasicBoard. The lines are
+// generated by the constructor and shared by all copies of the board.
+class DynamicBoard
+{
+public:
+    // Cell values on the board
+    using Cell = BoardCell;
+
+    // Largest number of rows or columns
+    static int constexpr MAX_SIZE = 32;
+
+    // False, since the size is not known until run time. Unlike BasicBoard, the board has no ranks.
+    static bool constexpr HAS_RANKS = false;
+
+    // Constructor. Creates an empty board. Throws std::runtime_error if the size is not valid, or if k is greater than both
+    // the number of rows and the number of columns.
+    DynamicBoard(int rows, int columns, int k);
+
+    // Returns the number of rows
+    int rows() const { return geometry_->rows; }
+
+    // Returns the number of columns
+    int columns() const { return geometry_->columns; }
+
+    // Returns the number of marks in a line needed to win
+    int lineLength() const { return geometry_->k; }
+
+    // Returns the number of cells
+    int cells() const { return static_cast<int>(cells_.size()); }
+
+    // Returns the cell value at the specified position
+    Cell at(int row, int column) const { return at(toIndex(row, column)); }
+
+    // Returns the cell value at the specified index
+    Cell at(int index) const
+    {
+        assert(index >= 0 && index < cells());
+        return cells_[index];
+    }
+
+    // Set the cell value at the specified position
+    void set(int row, int column, Cell value) { set(toIndex(row, column), value); }
+
+    // Set the cell value at the specified index
+    void set(int index, Cell value)
+    {
+        assert(index >= 0 && index < cells());
+        cells_[index] = value;
+    }
+
+    // Returns the number of winning lines
+    int numberOfLines() const { return static_cast<int>(geometry_->lines.size()); }
+
+    // Returns the indexes of the cells in a winning line. The lines are in the same order as BasicBoard::LINES.
+    std::vector<int> const & line(int i) const { return geometry_->lines[i]; }
+
+    // Returns the lines through a cell, as indexes of lines
+    std::vector<int> const & linesThrough(int index) const { return geometry_->linesThrough[index]; }
+
+    // Returns the value of the player with k in a line, or NEITHER if neither player has k in a line
+    Cell winner() const;
+
+    // Convert row/column to index
+    int toIndex(int row, int column) const
+    {
+        assert(row >= 0 && row < rows() && column >= 0 && column < columns());
+        return row * columns() + column;
+    }
+
+    // Convert index to row/column
+    std::pair<int, int> toPosition(int index) const
+    {
+        assert(index >= 0 && index < cells());
+        return std::make_pair(index / columns(), index % columns());
+    }
+
+private:
+    // The size of a board and its lines
+    struct Geometry
+    {
+        int                           rows;         // Number of rows
+        int                           columns;      // Number of columns
+        int                           k;            // Number of marks in a line needed to win
+        std::vector<std::vector<int>> lines;        // Cells in each winning line
+        std::vector<std::vector<int>> linesThrough; // Lines through each cell
+    };
+
+    std::shared_ptr<Geometry const> geometry_; // Shared by all copies of the board
+    std::vector<Cell>               cells_;    // Value of each cell
+
+    // Returns the geometry of a board, or throws std::runtime_error if the size is not valid
+    static std::shared_ptr<Geometry const> makeGeometry(int rows, int columns, int k);
+};
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+
+// A list of moves with a fixed capacity. It is stored in place, so generating moves does not allocate memory.
+//
+// Each state has a list whose capacity is its number of cells, since a player can never have more moves than that.
+template <typename Move, int Capacity>
+class BasicMoveList
+{
+public:
+    // Maximum number of moves in a list
+    static int constexpr CAPACITY = Capacity;
+
+    // Returns the number of moves in the list
+    int size() const { return size_; }
+
+    // Returns true if the list is empty
+    bool empty() const { return size_ == 0; }
+
+    // Removes all of the moves
+    void clear() { size_ = 0; }
+
+    // Adds a move to the end of the list. The list must not be full.
+    void push_back(Move const & move)
+    {
+        assert(size_ < CAPACITY);
+        moves_[size_++] = move;
+    }
+
+    // Returns the move at the specified position in the list
+    Move const & operator [](int i) const
+    {
+        assert(i >= 0 && i < size_);
+        return moves_[i];
+    }
+
+    Move & operator [](int i)
+    {
+        assert(i >= 0 && i < size_);
+        return moves_[i];
+    }
+
+    Move const * begin() const { return moves_.data(); }
+    Move const * end() const { return moves_.data() + size_; }
+    Move *       begin() { return moves_.data(); }
+    Move *       end() { return moves_.data() + size_; }
+
+private:
+    std::array<Move, CAPACITY> moves_;
+    int                        size_ = 0;
+};
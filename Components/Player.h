@@ -2,23 +2,40 @@
 
 #include "TicTacToeState/TicTacToeState.h"
 
-// Abstract base class for players in a tic-tac-toe game.
-class Player
+// Abstract base class for players in a tic-tac-toe game played with the specified State. Player is a player of the 3x3
+// game.
+template <typename State>
+class BasicPlayer
 {
 public:
-    explicit Player(TicTacToeState::PlayerId playerId)
+    using PlayerId = typename State::PlayerId;
+
+    explicit BasicPlayer(PlayerId playerId)
         : playerId_(playerId)
     {
     }
 
-    virtual ~Player() = default;
+    virtual ~BasicPlayer() = default;
 
     // Make a move on the given game state. This method must be overridden.
-    virtual void move(TicTacToeState * pState) = 0;
+    virtual void move(State * pState) = 0;
+
+    // Think about the given game state while waiting for the opponent to move. The default does nothing.
+    virtual void ponder(State const & /*state*/) {}
+
+    // Ask a move or pondering in progress on another thread to finish as soon as possible. The default does nothing.
+    virtual void cancel() {}
+
+    // Forget anything learned about the current game before a new game starts. It must not be called while a move or
+    // pondering is in progress. The default does nothing.
+    virtual void reset() {}
 
     // Get the player's ID.
-    TicTacToeState::PlayerId playerId() const { return playerId_; }
+    PlayerId playerId() const { return playerId_; }
 
 protected:
-    TicTacToeState::PlayerId playerId_;    // The player's ID
+    PlayerId playerId_;    // The player's ID
 };
+
+// A player of the 3x3 game
+using Player = BasicPlayer<TicTacToeState>;
@@ -0,0 +1,365 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Lookup tables for the boards.
+//
+// All of the tables are generated at compile time, so they live in read-only memory and need no initialization when the
+// program starts. Cells are indexed in row-major order, and a set of cells is a mask in which bit i corresponds to the cell
+// at index i. The tables for a board with ROWS rows and COLUMNS columns on which K marks in a line win are in
+// BasicTables<ROWS, COLUMNS, K>, and the tables for the 3x3 board are also available directly in this namespace. The tables
+// for the 4x4x4 cube of Qubic are in QubicTables.
+namespace Tables
+{
+// Returns the next value of a SplitMix64 sequence and advances the state. It is constexpr so that the Zobrist keys can be
+// generated at compile time.
+constexpr uint64_t splitMix64(uint64_t & state)
+{
+    uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+    z          = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z          = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+// The smallest unsigned integer with a bit for each of the specified number of cells
+template <int CELLS>
+using Mask = std::conditional_t<(CELLS <= 16), uint16_t, std::conditional_t<(CELLS <= 32), uint32_t, uint64_t>>;
+
+// The largest number of cells of a board with ranks. The rank of every such board fits in 64 bits, with a bit to spare for
+// the player to move.
+inline constexpr int MAX_RANKED_CELLS = 39;
+
+// The directions of the lines: across, down, down and to the right, and down and to the left
+inline constexpr int LINE_DIRECTIONS[4][2] = { { 0, 1 }, { 1, 0 }, { 1, 1 }, { 1, -1 } };
+
+// Calls visit(first, step) for each winning line of a board with the specified size, in the order of LINE_DIRECTIONS and
+// then by the index of the first cell. The cells of the line have the indexes first + i * step, for i in [0, k). With k = 1,
+// every direction gives the same lines, so only the first is used. It is constexpr so that the tables of the compiled boards
+// can be generated at compile time, and the boards whose size is only known at run time use it too.
+template <typename Visit>
+constexpr void forEachLine(int rows, int columns, int k, Visit visit)
+{
+    for (int d = 0; d < ((k == 1) ? 1 : 4); ++d)
+    {
+        for (int row = 0; row < rows; ++row)
+        {
+            for (int column = 0; column < columns; ++column)
+            {
+                int lastRow    = row + LINE_DIRECTIONS[d][0] * (k - 1);
+                int lastColumn = column + LINE_DIRECTIONS[d][1] * (k - 1);
+                if (lastRow < rows && lastColumn >= 0 && lastColumn < columns)
+                    visit(row * columns + column, LINE_DIRECTIONS[d][0] * columns + LINE_DIRECTIONS[d][1]);
+            }
+        }
+    }
+}
+
+// Returns the number of winning lines
+template <int ROWS, int COLUMNS, int K>
+constexpr int countLines()
+{
+    int count = 0;
+    forEachLine(ROWS, COLUMNS, K, [&count](int, int) { ++count; });
+    return count;
+}
+
+// Returns the masks of the winning lines, in the order of forEachLine()
+template <int ROWS, int COLUMNS, int K>
+constexpr std::array<Mask<ROWS * COLUMNS>, countLines<ROWS, COLUMNS, K>()> makeLines()
+{
+    std::array<Mask<ROWS * COLUMNS>, countLines<ROWS, COLUMNS, K>()> lines {};
+    int                                                              n = 0;
+    forEachLine(ROWS, COLUMNS, K, [&lines, &n](int first, int step) {
+        uint64_t line = 0;
+        for (int i = 0; i < K; ++i)
+        {
+            line |= uint64_t(1) << (first + i * step);
+        }
+        lines[n++] = static_cast<Mask<ROWS * COLUMNS>>(line);
+    });
+    return lines;
+}
+
+// The lines through a cell, as indexes into the lines of the board
+template <int CAPACITY>
+struct BasicLinesThrough
+{
+    int                       count;
+    std::array<int, CAPACITY> lines;
+};
+
+// Returns the largest number of lines through any one cell
+template <int CELLS, std::size_t NUMBER_OF_LINES>
+constexpr int countLinesThrough(std::array<Mask<CELLS>, NUMBER_OF_LINES> const & lines)
+{
+    int most = 0;
+    for (int i = 0; i < CELLS; ++i)
+    {
+        int count = 0;
+        for (auto line : lines)
+        {
+            if (line & (uint64_t(1) << i))
+                ++count;
+        }
+        most = (count > most) ? count : most;
+    }
+    return most;
+}
+
+// Returns the lines through each cell
+template <typename LINES_THROUGH, int CELLS, std::size_t NUMBER_OF_LINES>
+constexpr std::array<LINES_THROUGH, CELLS> makeLinesThrough(std::array<Mask<CELLS>, NUMBER_OF_LINES> const & lines)
+{
+    std::array<LINES_THROUGH, CELLS> table {};
+    for (int i = 0; i < CELLS; ++i)
+    {
+        for (int line = 0; line < static_cast<int>(NUMBER_OF_LINES); ++line)
+        {
+            if (lines[line] & (uint64_t(1) << i))
+                table[i].lines[table[i].count++] = line;
+        }
+    }
+    return table;
+}
+
+// Zobrist keys. Cell keys are indexed by cell index and cell value, and winner keys by cell value. Empty cells do not
+// contribute to the hash, so their keys are 0.
+template <int CELLS>
+struct BasicZobristKeys
+{
+    uint64_t cells[CELLS][3];
+    uint64_t turn;
+    uint64_t winners[3];
+};
+
+template <int CELLS>
+constexpr BasicZobristKeys<CELLS> makeZobristKeys()
+{
+    BasicZobristKeys<CELLS> keys {};
+    uint64_t                state = 0; // Not seeded, so the same values are generated for every build
+    for (int i = 0; i < CELLS; ++i)
+    {
+        keys.cells[i][0] = 0;
+        keys.cells[i][1] = splitMix64(state);
+        keys.cells[i][2] = splitMix64(state);
+    }
+    keys.turn = splitMix64(state);
+    for (int w = 0; w < 3; ++w)
+    {
+        keys.winners[w] = splitMix64(state);
+    }
+    return keys;
+}
+
+// For each symmetry, the index that each cell is moved to. A square board has 8 symmetries: the identity, the rotations by
+// 90, 180 and 270 degrees clockwise, and the reflections across the vertical axis, horizontal axis, main diagonal and
+// anti-diagonal. Any other board has 4: the identity, the rotation by 180 degrees, and the reflections across the vertical
+// and horizontal axes.
+template <int ROWS, int COLUMNS>
+constexpr std::array<std::array<int8_t, ROWS * COLUMNS>, (ROWS == COLUMNS) ? 8 : 4> makeSymmetries()
+{
+    std::array<std::array<int8_t, ROWS * COLUMNS>, (ROWS == COLUMNS) ? 8 : 4> table {};
+    for (int row = 0; row < ROWS; ++row)
+    {
+        for (int column = 0; column < COLUMNS; ++column)
+        {
+            int i             = row * COLUMNS + column;
+            int flippedRow    = ROWS - 1 - row;
+            int flippedColumn = COLUMNS - 1 - column;
+            if constexpr (ROWS == COLUMNS)
+            {
+                table[0][i] = static_cast<int8_t>(i);
+                table[1][i] = static_cast<int8_t>(column * COLUMNS + flippedRow);
+                table[2][i] = static_cast<int8_t>(flippedRow * COLUMNS + flippedColumn);
+                table[3][i] = static_cast<int8_t>(flippedColumn * COLUMNS + row);
+                table[4][i] = static_cast<int8_t>(row * COLUMNS + flippedColumn);
+                table[5][i] = static_cast<int8_t>(flippedRow * COLUMNS + column);
+                table[6][i] = static_cast<int8_t>(column * COLUMNS + row);
+                table[7][i] = static_cast<int8_t>(flippedColumn * COLUMNS + flippedRow);
+            }
+            else
+            {
+                table[0][i] = static_cast<int8_t>(i);
+                table[1][i] = static_cast<int8_t>(flippedRow * COLUMNS + flippedColumn);
+                table[2][i] = static_cast<int8_t>(row * COLUMNS + flippedColumn);
+                table[3][i] = static_cast<int8_t>(flippedRow * COLUMNS + column);
+            }
+        }
+    }
+    return table;
+}
+
+// Returns the powers of 3, used to compute the base-3 rank of a board. They overflow for boards with more cells than
+// BasicTables::HAS_RANKS allows, and are not used for them.
+template <typename RANK, int CELLS>
+constexpr std::array<RANK, CELLS> makePowersOf3()
+{
+    std::array<RANK, CELLS> powers {};
+    uint64_t                power = 1;
+    for (int i = 0; i < CELLS; ++i)
+    {
+        powers[i] = static_cast<RANK>(power);
+        power *= 3;
+    }
+    return powers;
+}
+
+// For each mask, the sum of the powers of 3 of its cells. The table is only made for small boards.
+template <typename ENTRY, int CELLS, int SIZE>
+constexpr std::array<ENTRY, SIZE> makeRanks()
+{
+    std::array<ENTRY, SIZE> table {};
+    for (int mask = 0; mask < SIZE; ++mask)
+    {
+        uint64_t rank  = 0;
+        uint64_t power = 1;
+        for (int i = 0; i < CELLS; ++i)
+        {
+            if (mask & (1 << i))
+                rank += power;
+            power *= 3;
+        }
+        table[mask] = static_cast<ENTRY>(rank);
+    }
+    return table;
+}
+
+// The tables for a board with ROWS rows and COLUMNS columns, on which K marks in a line win
+template <int ROWS, int COLUMNS, int K>
+struct BasicTables
+{
+    static_assert(ROWS > 0 && COLUMNS > 0 && ROWS * COLUMNS <= 64, "A board has between 1 and 64 cells");
+    static_assert(K > 0 && (K <= ROWS || K <= COLUMNS), "A line must fit on the board");
+
+    // Number of cells
+    static int constexpr CELLS = ROWS * COLUMNS;
+
+    // A set of cells
+    using Mask = Tables::Mask<CELLS>;
+
+    // Masks of the winning lines
+    static constexpr std::array<Mask, countLines<ROWS, COLUMNS, K>()> LINES = makeLines<ROWS, COLUMNS, K>();
+
+    // The lines through a cell
+    using LinesThrough = BasicLinesThrough<countLinesThrough<CELLS>(LINES)>;
+
+    // The lines through each cell
+    static constexpr std::array<LinesThrough, CELLS> LINES_THROUGH = makeLinesThrough<LinesThrough, CELLS>(LINES);
+
+    // For each symmetry, the index that each cell is moved to (see makeSymmetries())
+    static constexpr auto SYMMETRIES = makeSymmetries<ROWS, COLUMNS>();
+
+    // True if the board has ranks (see MAX_RANKED_CELLS)
+    static bool constexpr HAS_RANKS = CELLS <= MAX_RANKED_CELLS;
+
+    // Type of a rank. The ranks of the 3x3 board fit in an int.
+    using Rank = std::conditional_t<(CELLS <= 19), int, uint64_t>;
+
+    // Powers of 3, used to compute the base-3 rank of a board
+    static constexpr std::array<Rank, CELLS> POWERS_OF_3 = makePowersOf3<Rank, CELLS>();
+
+    // True if there is a table of the rank of each mask. The table has 2^CELLS entries, so only small boards have one.
+    static bool constexpr HAS_RANK_TABLE = CELLS <= 12;
+
+    // For each mask, the sum of the powers of 3 of its cells
+    static constexpr auto RANKS =
+        makeRanks<std::conditional_t<(CELLS <= 10), uint16_t, uint32_t>, CELLS, HAS_RANK_TABLE ? (1 << CELLS) : 0>();
+
+    // Zobrist keys
+    static constexpr BasicZobristKeys<CELLS> ZOBRIST_KEYS = makeZobristKeys<CELLS>();
+};
+
+// The tables for the 3x3 board
+using TicTacToeTables = BasicTables<3, 3, 3>;
+
+// Masks of the 8 winning lines: the rows, the columns, and the diagonals
+inline constexpr std::array<uint16_t, 8> const & LINES = TicTacToeTables::LINES;
+
+// The lines through a cell, as indexes into LINES
+using LinesThrough = TicTacToeTables::LinesThrough;
+
+// The lines through each cell
+inline constexpr std::array<LinesThrough, 9> const & LINES_THROUGH = TicTacToeTables::LINES_THROUGH;
+
+// For each symmetry, the index that each cell is moved to
+inline constexpr std::array<std::array<int8_t, 9>, 8> const & SYMMETRIES = TicTacToeTables::SYMMETRIES;
+
+// Powers of 3, used to compute the base-3 rank of a board
+inline constexpr std::array<int, 9> const & POWERS_OF_3 = TicTacToeTables::POWERS_OF_3;
+
+// For each mask, the sum of the powers of 3 of its cells
+inline constexpr std::array<uint16_t, 512> const & RANKS = TicTacToeTables::RANKS;
+
+// Zobrist keys
+using ZobristKeys = BasicZobristKeys<9>;
+
+inline constexpr ZobristKeys const & ZOBRIST_KEYS = TicTacToeTables::ZOBRIST_KEYS;
+
+// The directions of the lines in a cube, as (layer, row, column) steps. Each line is generated from one end only, so of each
+// pair of opposite directions, only the one with a positive first non-zero step is used: 3 along the axes, 6 diagonals of
+// the faces and 4 diagonals through the center of the cube.
+inline constexpr int CUBE_LINE_DIRECTIONS[13][3] = {
+    { 0, 0, 1 }, { 0, 1, 0 }, { 1, 0, 0 },                                        // Axes
+    { 0, 1, 1 }, { 0, 1, -1 }, { 1, 0, 1 }, { 1, 0, -1 }, { 1, 1, 0 }, { 1, -1, 0 }, // Face diagonals
+    { 1, 1, 1 }, { 1, 1, -1 }, { 1, -1, 1 }, { 1, -1, -1 }                          // Space diagonals
+};
+
+// Returns the masks of the lines of N cells in an NxNxN cube, in the order of CUBE_LINE_DIRECTIONS, and then by the index of
+// the first cell. Cell (layer, row, column) has index (layer * N + row) * N + column.
+template <int N>
+constexpr std::array<uint64_t, ((N + 2) * (N + 2) * (N + 2) - N * N * N) / 2> makeCubeLines()
+{
+    std::array<uint64_t, ((N + 2) * (N + 2) * (N + 2) - N * N * N) / 2> lines {};
+    int                                                                  n = 0;
+    for (auto const & d : CUBE_LINE_DIRECTIONS)
+    {
+        for (int layer = 0; layer < N; ++layer)
+        {
+            for (int row = 0; row < N; ++row)
+            {
+                for (int column = 0; column < N; ++column)
+                {
+                    int last[3] = { layer + d[0] * (N - 1), row + d[1] * (N - 1), column + d[2] * (N - 1) };
+                    if (last[0] < 0 || last[0] >= N || last[1] < 0 || last[1] >= N || last[2] < 0 || last[2] >= N)
+                        continue;
+                    uint64_t line = 0;
+                    for (int i = 0; i < N; ++i)
+                    {
+                        line |= uint64_t(1) << (((layer + d[0] * i) * N + row + d[1] * i) * N + column + d[2] * i);
+                    }
+                    lines[n++] = line;
+                }
+            }
+        }
+    }
+    return lines;
+}
+
+// The tables for Qubic, which is played on a 4x4x4 cube, where 4 marks in a line win
+struct QubicTables
+{
+    // Number of cells on a side
+    static int constexpr SIZE = 4;
+
+    // Number of cells
+    static int constexpr CELLS = SIZE * SIZE * SIZE;
+
+    // A set of cells
+    using Mask = Tables::Mask<CELLS>;
+
+    // Masks of the 76 winning lines: 48 along the axes, 24 on the diagonals of the layers, and 4 through the center
+    static constexpr std::array<Mask, 76> LINES = makeCubeLines<SIZE>();
+
+    // The lines through a cell. The corners and the 8 center cells are on 7 lines, and the rest are on 4.
+    using LinesThrough = BasicLinesThrough<countLinesThrough<CELLS>(LINES)>;
+
+    // The lines through each cell
+    static constexpr std::array<LinesThrough, CELLS> LINES_THROUGH = makeLinesThrough<LinesThrough, CELLS>(LINES);
+
+    // Zobrist keys
+    static constexpr BasicZobristKeys<CELLS> ZOBRIST_KEYS = makeZobristKeys<CELLS>();
+};
+} // namespace Tables
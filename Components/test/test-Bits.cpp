@@ -0,0 +1,27 @@
+#include "gtest/gtest.h"
+
+#include "Components/Bits.h"
+
+#include <cstdint>
+
+namespace TicTacToe
+{
+TEST(Bits, FirstIndex)
+{
+    EXPECT_EQ(Bits::firstIndex(uint16_t(0x0001)), 0);
+    EXPECT_EQ(Bits::firstIndex(uint16_t(0x8000)), 15);
+    EXPECT_EQ(Bits::firstIndex(uint16_t(0x0ff0)), 4);
+    EXPECT_EQ(Bits::firstIndex(uint32_t(0x80000000)), 31);
+    EXPECT_EQ(Bits::firstIndex(uint64_t(1) << 63), 63);
+    EXPECT_EQ(Bits::firstIndex(~uint64_t(0) << 40), 40);
+}
+
+TEST(Bits, Count)
+{
+    EXPECT_EQ(Bits::count(uint16_t(0)), 0);
+    EXPECT_EQ(Bits::count(uint16_t(0xffff)), 16);
+    EXPECT_EQ(Bits::count(uint32_t(0xf0f0f0f0)), 16);
+    EXPECT_EQ(Bits::count(~uint64_t(0)), 64);
+    EXPECT_EQ(Bits::count((uint64_t(1) << 63) | 1), 2);
+}
+} // namespace TicTacToe
@@ -161,4 +161,225 @@ TEST(Board, ToPosition)
         EXPECT_EQ(c, i % 3);
     }
 }
+
+TEST(Board, Mask)
+{
+    std::array<Board::Cell, 9> boardData = {
+        Board::Cell::X,       Board::Cell::O,       Board::Cell::NEITHER,
+        Board::Cell::NEITHER, Board::Cell::X,       Board::Cell::NEITHER,
+        Board::Cell::O,       Board::Cell::NEITHER, Board::Cell::X
+    };
+    Board board(boardData);
+    EXPECT_EQ(board.mask(Board::Cell::X), 0x111);
+    EXPECT_EQ(board.mask(Board::Cell::O), 0x042);
+    EXPECT_EQ(board.mask(Board::Cell::NEITHER), 0x0ac);
+    EXPECT_EQ(board.emptyMask(), 0x0ac);
+    EXPECT_EQ(Board().emptyMask(), Board::ALL);
+
+    // Changing a cell moves it from one mask to another
+    board.set(0, Board::Cell::O);
+    EXPECT_EQ(board.mask(Board::Cell::X), 0x110);
+    EXPECT_EQ(board.mask(Board::Cell::O), 0x043);
+    board.set(0, Board::Cell::NEITHER);
+    EXPECT_EQ(board.mask(Board::Cell::O), 0x042);
+    EXPECT_EQ(board.emptyMask(), 0x0ad);
+}
+
+TEST(Board, Winner)
+{
+    EXPECT_EQ(Board().winner(), Board::Cell::NEITHER);
+
+    // Every line wins for X and for O
+    for (Board::Mask line : Board::LINES)
+    {
+        Board boardX;
+        Board boardO;
+        for (int i = 0; i < 9; ++i)
+        {
+            if (line & (1 << i))
+            {
+                boardX.set(i, Board::Cell::X);
+                boardO.set(i, Board::Cell::O);
+            }
+        }
+        EXPECT_EQ(boardX.winner(), Board::Cell::X);
+        EXPECT_EQ(boardO.winner(), Board::Cell::O);
+    }
+
+    // A full board with no lines has no winner
+    Board draw({{
+                   Board::Cell::O, Board::Cell::O, Board::Cell::X,
+                   Board::Cell::X, Board::Cell::X, Board::Cell::O,
+                   Board::Cell::O, Board::Cell::X, Board::Cell::X
+               }});
+    EXPECT_EQ(draw.winner(), Board::Cell::NEITHER);
+}
+
+TEST(Board, HasLine)
+{
+    EXPECT_FALSE(Board::hasLine(0));
+    EXPECT_TRUE(Board::hasLine(Board::ALL));
+    EXPECT_FALSE(Board::hasLine(0x0ab));
+    for (Board::Mask line : Board::LINES)
+    {
+        EXPECT_TRUE(Board::hasLine(line));
+        for (int i = 0; i < 9; ++i)
+        {
+            if (line & (1 << i))
+            {
+                EXPECT_FALSE(Board::hasLine(line & ~(1 << i)));
+            }
+        }
+    }
+}
+
+TEST(Board, FirstIndex)
+{
+    for (int i = 0; i < 9; ++i)
+    {
+        EXPECT_EQ(Board::firstIndex(Board::Mask(1 << i)), i);
+        EXPECT_EQ(Board::firstIndex(Board::Mask(Board::ALL << i)), i);
+    }
+}
+
+TEST(Board, Count)
+{
+    EXPECT_EQ(Board::count(0), 0);
+    EXPECT_EQ(Board::count(Board::ALL), 9);
+    for (Board::Mask line : Board::LINES)
+    {
+        EXPECT_EQ(Board::count(line), 3);
+    }
+}
+
+TEST(Board, Rank)
+{
+    EXPECT_EQ(Board().rank(), 0);
+
+    // The rank of each single mark is its value times the power of 3 of its index
+    for (int i = 0; i < 9; ++i)
+    {
+        for (Board::Cell cell : { Board::Cell::X, Board::Cell::O })
+        {
+            Board board;
+            board.set(i, cell);
+            EXPECT_EQ(board.rank(), Board::rankOf(cell, i));
+            EXPECT_EQ(board.rank(), static_cast<int>(cell) * Board::POWERS_OF_3[i]);
+        }
+    }
+
+    // A full board of Os has the highest rank
+    Board full;
+    for (int i = 0; i < 9; ++i)
+    {
+        full.set(i, Board::Cell::O);
+    }
+    EXPECT_EQ(full.rank(), Board::NUMBER_OF_RANKS - 1);
+}
+
+TEST(Board, Unrank)
+{
+    // unrank() is the inverse of rank() for every rank
+    for (int rank = 0; rank < Board::NUMBER_OF_RANKS; ++rank)
+    {
+        Board board = Board::unrank(rank);
+        ASSERT_EQ(board.rank(), rank);
+        ASSERT_EQ(Board(board.value()).rank(), rank);
+    }
+}
+
+TEST(Board, Transform)
+{
+    for (int s = 0; s < Board::NUMBER_OF_SYMMETRIES; ++s)
+    {
+        // Each symmetry is a permutation of the cells that leaves the center alone and maps lines to lines
+        Board::Mask image = 0;
+        for (int i = 0; i < 9; ++i)
+        {
+            image |= 1 << Board::transform(i, s);
+        }
+        EXPECT_EQ(image, Board::ALL);
+        EXPECT_EQ(Board::transform(4, s), 4);
+        for (Board::Mask line : Board::LINES)
+        {
+            Board::Mask transformed = 0;
+            for (int i = 0; i < 9; ++i)
+            {
+                if (line & (1 << i))
+                    transformed |= 1 << Board::transform(i, s);
+            }
+            EXPECT_TRUE(Board::hasLine(transformed));
+        }
+    }
+
+    // The rotations
+    EXPECT_EQ(Board::transform(0, 1), 2);
+    EXPECT_EQ(Board::transform(0, 2), 8);
+    EXPECT_EQ(Board::transform(0, 3), 6);
+}
+
+TEST(Board, Inverse)
+{
+    for (int s = 0; s < Board::NUMBER_OF_SYMMETRIES; ++s)
+    {
+        for (int i = 0; i < 9; ++i)
+        {
+            EXPECT_EQ(Board::transform(Board::transform(i, s), Board::inverse(s)), i);
+        }
+    }
+}
+
+TEST(Board, Transformed)
+{
+    Board board({{
+                    Board::Cell::X,       Board::Cell::O,       Board::Cell::NEITHER,
+                    Board::Cell::NEITHER, Board::Cell::NEITHER, Board::Cell::NEITHER,
+                    Board::Cell::NEITHER, Board::Cell::NEITHER, Board::Cell::NEITHER
+                }});
+    Board rotated = board.transformed(1);
+    EXPECT_EQ(rotated.at(0, 2), Board::Cell::X);
+    EXPECT_EQ(rotated.at(1, 2), Board::Cell::O);
+    EXPECT_EQ(rotated.mask(Board::Cell::NEITHER), Board::ALL & ~0x024);
+    EXPECT_EQ(board.transformed(0).value(), board.value());
+    for (int s = 0; s < Board::NUMBER_OF_SYMMETRIES; ++s)
+    {
+        EXPECT_EQ(board.transformed(s).transformed(Board::inverse(s)).value(), board.value());
+    }
+}
+
+TEST(Board, Sizes)
+{
+    using Board44 = BasicBoard<4, 4, 4>;
+    using Board77 = BasicBoard<7, 7, 4>;
+
+    Board44 board44;
+    EXPECT_EQ(board44.cells(), 16);
+    board44.set(3, 3, Board44::Cell::X);
+    EXPECT_EQ(board44.at(15), Board44::Cell::X);
+    EXPECT_EQ(board44.emptyMask(), 0x7fff);
+    EXPECT_EQ(board44.rank(), Board44::POWERS_OF_3[15]);
+    EXPECT_EQ(Board44::unrank(board44.rank()).value(), board44.value());
+    EXPECT_EQ(board44.transformed(1).at(3, 0), Board44::Cell::X);
+
+    // 4 in a diagonal wins on a 4x4 board, but 3 do not
+    for (int i = 0; i < 3; ++i)
+    {
+        board44.set(i, i, Board44::Cell::X);
+    }
+    EXPECT_EQ(board44.winner(), Board44::Cell::X);
+    board44.set(0, 0, Board44::Cell::O);
+    EXPECT_EQ(board44.winner(), Board44::Cell::NEITHER);
+
+    // Cells above 31 work on a 7x7 board
+    Board77 board77;
+    for (int c = 2; c < 6; ++c)
+    {
+        board77.set(6, c, Board77::Cell::O);
+    }
+    EXPECT_EQ(board77.winner(), Board77::Cell::O);
+    EXPECT_EQ(Board77::count(board77.mask(Board77::Cell::O)), 4);
+    EXPECT_EQ(Board77::firstIndex(board77.mask(Board77::Cell::O)), 44);
+    EXPECT_EQ(Board77::count(board77.emptyMask()), 45);
+    EXPECT_EQ(board77.transformed(2).at(0, 1), Board77::Cell::O);
+}
 } // namespace TicTacToe
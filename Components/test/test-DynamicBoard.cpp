@@ -0,0 +1,96 @@
+#include "gtest/gtest.h"
+
+#include "Components/Board.h"
+#include "Components/DynamicBoard.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace TicTacToe
+{
+// Returns true if the lines of a dynamic board are the same as the lines of the compiled board of the same size
+template <typename Board>
+static bool sameLines(DynamicBoard const & dynamic)
+{
+    if (dynamic.numberOfLines() != Board::NUMBER_OF_LINES)
+        return false;
+    for (int i = 0; i < Board::NUMBER_OF_LINES; ++i)
+    {
+        typename Board::Mask mask = 0;
+        for (int index : dynamic.line(i))
+        {
+            mask |= typename Board::Mask(typename Board::Mask(1) << index);
+        }
+        if (mask != Board::LINES[i])
+            return false;
+    }
+    return true;
+}
+
+TEST(DynamicBoard, Constructor)
+{
+    DynamicBoard board(4, 5, 3);
+    EXPECT_EQ(board.rows(), 4);
+    EXPECT_EQ(board.columns(), 5);
+    EXPECT_EQ(board.lineLength(), 3);
+    EXPECT_EQ(board.cells(), 20);
+    for (int i = 0; i < board.cells(); ++i)
+    {
+        EXPECT_EQ(board.at(i), DynamicBoard::Cell::NEITHER);
+    }
+
+    EXPECT_THROW(DynamicBoard(0, 3, 3), std::runtime_error);
+    EXPECT_THROW(DynamicBoard(3, DynamicBoard::MAX_SIZE + 1, 3), std::runtime_error);
+    EXPECT_THROW(DynamicBoard(3, 3, 0), std::runtime_error);
+    EXPECT_THROW(DynamicBoard(3, 3, 4), std::runtime_error);
+    EXPECT_NO_THROW(DynamicBoard(1, 4, 4));
+}
+
+TEST(DynamicBoard, Lines)
+{
+    // The lines are the same, and in the same order, as the lines of the compiled boards
+    EXPECT_TRUE(sameLines<Board>(DynamicBoard(3, 3, 3)));
+    EXPECT_TRUE((sameLines<BasicBoard<3, 4, 3>>(DynamicBoard(3, 4, 3))));
+    EXPECT_TRUE((sameLines<BasicBoard<4, 4, 4>>(DynamicBoard(4, 4, 4))));
+    EXPECT_TRUE((sameLines<BasicBoard<7, 7, 4>>(DynamicBoard(7, 7, 4))));
+    EXPECT_TRUE((sameLines<BasicBoard<2, 2, 1>>(DynamicBoard(2, 2, 1))));
+
+    // Each line through a cell contains the cell
+    DynamicBoard board(6, 5, 4);
+    int          total = 0;
+    for (int i = 0; i < board.cells(); ++i)
+    {
+        for (int line : board.linesThrough(i))
+        {
+            std::vector<int> const & cells = board.line(line);
+            EXPECT_NE(std::find(cells.begin(), cells.end(), i), cells.end());
+            ++total;
+        }
+    }
+    EXPECT_EQ(total, board.numberOfLines() * 4);
+}
+
+TEST(DynamicBoard, SetAndWinner)
+{
+    DynamicBoard board(5, 6, 4);
+    board.set(1, 2, DynamicBoard::Cell::X);
+    EXPECT_EQ(board.at(1, 2), DynamicBoard::Cell::X);
+    EXPECT_EQ(board.at(board.toIndex(1, 2)), DynamicBoard::Cell::X);
+    EXPECT_EQ(board.toPosition(board.toIndex(1, 2)), std::make_pair(1, 2));
+
+    // 4 in an anti-diagonal wins, but 3 do not
+    board.set(1, 5, DynamicBoard::Cell::O);
+    board.set(2, 4, DynamicBoard::Cell::O);
+    board.set(3, 3, DynamicBoard::Cell::O);
+    EXPECT_EQ(board.winner(), DynamicBoard::Cell::NEITHER);
+    board.set(4, 2, DynamicBoard::Cell::O);
+    EXPECT_EQ(board.winner(), DynamicBoard::Cell::O);
+
+    // Copies are independent
+    DynamicBoard copy = board;
+    copy.set(4, 2, DynamicBoard::Cell::NEITHER);
+    EXPECT_EQ(copy.winner(), DynamicBoard::Cell::NEITHER);
+    EXPECT_EQ(board.winner(), DynamicBoard::Cell::O);
+}
+} // namespace TicTacToe
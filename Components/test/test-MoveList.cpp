@@ -0,0 +1,49 @@
+#include "gtest/gtest.h"
+
+#include "Components/MoveList.h"
+
+#include <vector>
+
+namespace TicTacToe
+{
+struct TestMove
+{
+    int index;
+};
+
+using TestMoveList = BasicMoveList<TestMove, 4>;
+
+TEST(MoveList, Constructor)
+{
+    TestMoveList moves;
+    EXPECT_EQ(TestMoveList::CAPACITY, 4);
+    EXPECT_EQ(moves.size(), 0);
+    EXPECT_TRUE(moves.empty());
+    EXPECT_EQ(moves.begin(), moves.end());
+}
+
+TEST(MoveList, Push_back_clear)
+{
+    TestMoveList moves;
+    for (int i = 0; i < TestMoveList::CAPACITY; ++i)
+    {
+        moves.push_back({ i * 10 });
+    }
+    EXPECT_EQ(moves.size(), 4);
+    EXPECT_FALSE(moves.empty());
+
+    // The moves are kept in the order they were added
+    std::vector<int> indexes;
+    for (TestMove const & move : moves)
+    {
+        indexes.push_back(move.index);
+    }
+    EXPECT_EQ(indexes, std::vector<int>({ 0, 10, 20, 30 }));
+    moves[2].index = 25;
+    EXPECT_EQ(moves[2].index, 25);
+
+    moves.clear();
+    EXPECT_EQ(moves.size(), 0);
+    EXPECT_TRUE(moves.empty());
+}
+} // namespace TicTacToe
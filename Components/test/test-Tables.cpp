@@ -0,0 +1,188 @@
+#include "gtest/gtest.h"
+
+#include "Components/Tables.h"
+
+#include <bitset>
+#include <set>
+#include <type_traits>
+#include <vector>
+
+namespace TicTacToe
+{
+// The tables are usable in constant expressions
+static_assert(Tables::LINES[0] == 0x007, "LINES must be constexpr");
+static_assert(Tables::LINES_THROUGH[4].count == 4, "LINES_THROUGH must be constexpr");
+static_assert(Tables::RANKS[0x1ff] == 9841, "RANKS must be constexpr");
+static_assert(Tables::ZOBRIST_KEYS.cells[0][0] == 0, "ZOBRIST_KEYS must be constexpr");
+
+// The 3x3 tables are the smallest that fit
+static_assert(sizeof(Tables::TicTacToeTables::Mask) == 2, "The 3x3 masks must be 16 bits");
+static_assert(std::is_same<Tables::TicTacToeTables::Rank, int>::value, "The 3x3 ranks must be ints");
+
+TEST(Tables, SplitMix64)
+{
+    // The first values of the sequence starting with a state of 0
+    uint64_t state = 0;
+    EXPECT_EQ(Tables::splitMix64(state), 0xe220a8397b1dcdafull);
+    EXPECT_EQ(Tables::splitMix64(state), 0x6e789e6aa1b965f4ull);
+    EXPECT_EQ(Tables::splitMix64(state), 0x06c45d188009454full);
+}
+
+TEST(Tables, LinesThrough)
+{
+    int total = 0;
+    for (int i = 0; i < 9; ++i)
+    {
+        Tables::LinesThrough const & through = Tables::LINES_THROUGH[i];
+        total += through.count;
+        for (int j = 0; j < through.count; ++j)
+        {
+            EXPECT_TRUE(Tables::LINES[through.lines[j]] & (1 << i));
+        }
+    }
+    EXPECT_EQ(total, 8 * 3); // Each line passes through 3 cells
+    EXPECT_EQ(Tables::LINES_THROUGH[0].count, 3);
+    EXPECT_EQ(Tables::LINES_THROUGH[1].count, 2);
+    EXPECT_EQ(Tables::LINES_THROUGH[4].count, 4);
+}
+
+TEST(Tables, Symmetries)
+{
+    for (auto const & symmetry : Tables::SYMMETRIES)
+    {
+        std::set<int> image(symmetry.begin(), symmetry.end());
+        EXPECT_EQ(image.size(), 9u);
+    }
+}
+
+TEST(Tables, Ranks)
+{
+    for (int mask = 0; mask < 512; ++mask)
+    {
+        int rank = 0;
+        for (int i = 0; i < 9; ++i)
+        {
+            if (mask & (1 << i))
+                rank += Tables::POWERS_OF_3[i];
+        }
+        EXPECT_EQ(Tables::RANKS[mask], rank);
+    }
+}
+
+TEST(Tables, ZobristKeys)
+{
+    // Empty cells don't contribute, and all other keys are distinct and non-zero
+    std::set<uint64_t> keys;
+    for (int i = 0; i < 9; ++i)
+    {
+        EXPECT_EQ(Tables::ZOBRIST_KEYS.cells[i][0], 0u);
+        keys.insert(Tables::ZOBRIST_KEYS.cells[i][1]);
+        keys.insert(Tables::ZOBRIST_KEYS.cells[i][2]);
+    }
+    keys.insert(Tables::ZOBRIST_KEYS.turn);
+    for (uint64_t winner : Tables::ZOBRIST_KEYS.winners)
+    {
+        keys.insert(winner);
+    }
+    EXPECT_EQ(keys.size(), 9u * 2 + 1 + 3);
+    EXPECT_EQ(keys.count(0), 0u);
+}
+
+TEST(Tables, ForEachLine)
+{
+    // The lines of a board whose size is only known at run time are the lines of the compiled board of the same size
+    std::vector<uint64_t> lines;
+    Tables::forEachLine(3, 4, 3, [&lines](int first, int step) {
+        lines.push_back((uint64_t(1) << first) | (uint64_t(1) << (first + step)) | (uint64_t(1) << (first + 2 * step)));
+    });
+    auto const & expected = Tables::BasicTables<3, 4, 3>::LINES;
+    ASSERT_EQ(lines.size(), expected.size());
+    for (size_t i = 0; i < lines.size(); ++i)
+    {
+        EXPECT_EQ(lines[i], expected[i]);
+    }
+
+    // With k = 1, each cell is a line once
+    int count = 0;
+    Tables::forEachLine(2, 3, 1, [&count](int first, int) { EXPECT_EQ(first, count++); });
+    EXPECT_EQ(count, 6);
+}
+
+TEST(Tables, Sizes)
+{
+    // Number of lines of K cells on an R x C board: R(C-K+1) rows, C(R-K+1) columns, and 2(R-K+1)(C-K+1) diagonals
+    EXPECT_EQ((Tables::BasicTables<3, 3, 3>::LINES.size()), 8u);
+    EXPECT_EQ((Tables::BasicTables<3, 4, 3>::LINES.size()), 14u);
+    EXPECT_EQ((Tables::BasicTables<4, 4, 4>::LINES.size()), 10u);
+    EXPECT_EQ((Tables::BasicTables<7, 7, 4>::LINES.size()), 88u);
+
+    // Square boards have 8 symmetries, others have 4
+    EXPECT_EQ((Tables::BasicTables<4, 4, 4>::SYMMETRIES.size()), 8u);
+    EXPECT_EQ((Tables::BasicTables<3, 4, 3>::SYMMETRIES.size()), 4u);
+
+    // The masks are the smallest integers that fit
+    EXPECT_EQ(sizeof(Tables::BasicTables<4, 4, 4>::Mask), 2u);
+    EXPECT_EQ(sizeof(Tables::BasicTables<5, 5, 4>::Mask), 4u);
+    EXPECT_EQ(sizeof(Tables::BasicTables<7, 7, 4>::Mask), 8u);
+
+    // Big boards have no ranks
+    EXPECT_TRUE((Tables::BasicTables<6, 6, 4>::HAS_RANKS));
+    EXPECT_FALSE((Tables::BasicTables<7, 7, 4>::HAS_RANKS));
+}
+
+TEST(Tables, LinesThrough_7x7)
+{
+    using Tables77 = Tables::BasicTables<7, 7, 4>;
+    int total      = 0;
+    for (int i = 0; i < 49; ++i)
+    {
+        Tables77::LinesThrough const & through = Tables77::LINES_THROUGH[i];
+        total += through.count;
+        for (int j = 0; j < through.count; ++j)
+        {
+            EXPECT_TRUE(Tables77::LINES[through.lines[j]] & (uint64_t(1) << i));
+        }
+    }
+    EXPECT_EQ(total, 88 * 4); // Each line passes through 4 cells
+    EXPECT_EQ(Tables77::LINES_THROUGH[0].count, 3);
+    EXPECT_EQ(Tables77::LINES_THROUGH[24].count, 16);
+}
+
+TEST(Tables, Qubic)
+{
+    using Qubic = Tables::QubicTables;
+
+    // Each line has 4 distinct cells, and no line is generated twice
+    for (size_t i = 0; i < Qubic::LINES.size(); ++i)
+    {
+        EXPECT_EQ(std::bitset<64>(Qubic::LINES[i]).count(), 4u);
+        for (size_t j = 0; j < i; ++j)
+        {
+            EXPECT_NE(Qubic::LINES[i], Qubic::LINES[j]);
+        }
+    }
+
+    // The 8 corners and the 8 cells in the center of the cube are on 7 lines, and the other 48 cells are on 4
+    int total  = 0;
+    int sevens = 0;
+    for (int i = 0; i < Qubic::CELLS; ++i)
+    {
+        Qubic::LinesThrough const & through = Qubic::LINES_THROUGH[i];
+        total += through.count;
+        sevens += (through.count == 7) ? 1 : 0;
+        EXPECT_TRUE(through.count == 4 || through.count == 7);
+        for (int j = 0; j < through.count; ++j)
+        {
+            EXPECT_TRUE(Qubic::LINES[through.lines[j]] & (uint64_t(1) << i));
+        }
+    }
+    EXPECT_EQ(total, 76 * 4);
+    EXPECT_EQ(sevens, 16);
+    EXPECT_EQ(Qubic::LINES_THROUGH[0].count, 7);  // Corner
+    EXPECT_EQ(Qubic::LINES_THROUGH[21].count, 7); // (1, 1, 1), in the center
+    EXPECT_EQ(Qubic::LINES_THROUGH[1].count, 4);  // (0, 0, 1), on an edge
+
+    // The space diagonal from corner to corner
+    EXPECT_EQ(Qubic::LINES[72], (uint64_t(1) << 0) | (uint64_t(1) << 21) | (uint64_t(1) << 42) | (uint64_t(1) << 63));
+}
+} // namespace TicTacToe
@@ -1,5 +1,9 @@
 #include "ComputerPlayer.h"
 
+#include "NegamaxSearch.h"
+#include "LazySmpSearch.h"
+#include "ParallelSearch.h"
+#include "StatePool.h"
 #include "TicTacToeEvaluator.h"
 
 #include "Components/Board.h"
@@ -7,38 +11,57 @@
 #include "GamePlayer/TranspositionTable.h"
 #include "TicTacToeState/TicTacToeState.h"
 
-#if defined(ANALYSIS_TRANSPOSITION_TABLE)
-#include <nlohmann/json.hpp>
-using json = nlohmann::json;
-#endif // defined(ANALYSIS_TRANSPOSITION_TABLE)
-
 #include <cassert>
-#include <ctime>
+#include <chrono>
 #include <functional>
-#include <iostream>
 #include <memory>
 #include <vector>
 
 static const int TOTAL_NUMBER_OF_POSSIBLE_STATES = 362880; // 9! possible states in tic-tac-toe (not all valid)
-static const int MAXIMUM_DEPTH                   = 8;      // Maximum depth of the game tree for tic-tac-toe (plies 0 - 8)
+static const int SHARED_TABLE_SIZE               = 65536;  // Entries in the table shared by Lazy SMP threads (1 MB)
 
 ComputerPlayer::ComputerPlayer(TicTacToeState::PlayerId playerId)
+    : ComputerPlayer(playerId, Options())
+{
+}
+
+ComputerPlayer::ComputerPlayer(TicTacToeState::PlayerId playerId, Options const & options)
     : Player(playerId)
-    , gameTree_(nullptr)
+    , options_(options)
     , staticEvaluator_(nullptr)
     , transpositionTable_(nullptr)
+    , generatedStates_(0)
 {
-    staticEvaluator_    = std::make_shared<TicTacToeEvaluator>();
-    transpositionTable_ = std::make_shared<GamePlayer::TranspositionTable>(TOTAL_NUMBER_OF_POSSIBLE_STATES, MAXIMUM_DEPTH);
-    gameTree_           = new GamePlayer::GameTree(transpositionTable_,
-                                         staticEvaluator_,
-                                         std::bind(&ComputerPlayer::responseGenerator,
-                                                   this,
-                                                   std::placeholders::_1,
-                                                   std::placeholders::_2),
-                                         MAXIMUM_DEPTH);
+    staticEvaluator_ = std::make_shared<TicTacToeEvaluator>();
+    bool parallel = options_.engine == Options::Engine::NEGAMAX && options_.threads != 1;
+    if (parallel && options_.parallelism == Options::Parallelism::LAZY_SMP)
+    {
+        lazySmpSearcher_ =
+            std::make_unique<LazySmpSearcher>(*staticEvaluator_, options_.maxDepth, SHARED_TABLE_SIZE, options_.threads);
+    }
+    else if (parallel)
+    {
+        parallelSearcher_ = std::make_unique<ParallelSearcher>(*staticEvaluator_, options_.maxDepth, options_.threads);
+    }
+    else if (options_.engine == Options::Engine::NEGAMAX)
+    {
+        searcher_ = std::make_unique<Searcher>(*staticEvaluator_, options_.maxDepth);
+    }
+    else
+    {
+        transpositionTable_ = std::make_shared<GamePlayer::TranspositionTable>(TOTAL_NUMBER_OF_POSSIBLE_STATES, options_.maxDepth);
+        gameTree_           = std::make_unique<GamePlayer::GameTree>(transpositionTable_,
+                                                           staticEvaluator_,
+                                                           std::bind(&ComputerPlayer::responseGenerator,
+                                                                     this,
+                                                                     std::placeholders::_1,
+                                                                     std::placeholders::_2),
+                                                           options_.maxDepth);
+    }
 }
 
+ComputerPlayer::~ComputerPlayer() = default;
+
 void ComputerPlayer::move(TicTacToeState * pState)
 {
     // Let's be safe and check if the state is valid
@@ -47,31 +70,170 @@ void ComputerPlayer::move(TicTacToeState * pState)
         return;
     }
 
-    // Find the best response to the current state
+    stop_.start();
+
+    // If the state was searched while pondering, the move is already known
+    auto reply = replies_.find(pState->index());
+    if (reply != replies_.end())
+    {
+        auto start         = std::chrono::steady_clock::now();
+        auto [row, column] = Board::toPosition(reply->second);
+        pState->move(row, column);
+        lastStatistics_         = SearchStatistics();
+        lastStatistics_.elapsed = std::chrono::steady_clock::now() - start;
+    }
+    else
+    {
+        lastStatistics_ = think(pState);
+    }
+    totalStatistics_ += lastStatistics_;
+
+    // The replies were to the state before this move, so they are of no further use
+    replies_.clear();
+
+    stop_.finish();
+}
+
+void ComputerPlayer::ponder(TicTacToeState const & state)
+{
+    // Let's be safe and check if the state is valid
+    if (state.isDone() || state.whoseTurn() == playerId_)
+    {
+        return;
+    }
+
+    stop_.start();
+    replies_.clear();
+
+    // Find the move for each of the opponent's replies. A move is not kept if the search is stopped before it finishes.
+    TicTacToeState::MoveList replies;
+    state.generateMoves(&replies);
+    for (TicTacToeState::Move const & reply : replies)
+    {
+        TicTacToeState response(state);
+        response.move(reply.row, reply.column);
+        if (response.isDone())
+            continue;
+
+        int              index      = response.index();
+        Board::Mask      empty      = response.board().emptyMask();
+        SearchStatistics statistics = think(&response);
+        totalStatistics_ += statistics;
+        if (stop_.requested())
+            break;
+        replies_[index] = Board::firstIndex(empty & ~response.board().emptyMask());
+    }
+
+    stop_.finish();
+}
+
+void ComputerPlayer::cancel()
+{
+    stop_.request();
+}
+
+void ComputerPlayer::reset()
+{
+    replies_.clear();
+}
+
+SearchStatistics ComputerPlayer::think(TicTacToeState * pState)
+{
+    // The searchers count their own work. The game tree does not, so the response generator counts the states it generates.
+    if (lazySmpSearcher_)
+        lazySmpSearcher_->resetStatistics();
+    if (parallelSearcher_)
+        parallelSearcher_->resetStatistics();
+    if (searcher_)
+        searcher_->resetStatistics();
+    generatedStates_ = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    search(pState);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    SearchStatistics statistics;
+    if (lazySmpSearcher_)
+        statistics = lazySmpSearcher_->statistics();
+    else if (parallelSearcher_)
+        statistics = parallelSearcher_->statistics();
+    else if (searcher_)
+        statistics = searcher_->statistics();
+    else
+        statistics.nodes = generatedStates_;
+    statistics.elapsed = elapsed;
+    return statistics;
+}
+
+void ComputerPlayer::search(TicTacToeState * pState)
+{
+    if (lazySmpSearcher_)
+    {
+        LazySmpSearcher::Budget budget;
+        budget.time               = options_.timeBudget;
+        budget.nodes              = options_.nodeBudget;
+        budget.pStop              = stop_.flag();
+        TicTacToeState::Move best = lazySmpSearcher_->findBestMove(*pState, budget);
+        pState->move(best.row, best.column);
+        return;
+    }
+
+    if (parallelSearcher_)
+    {
+        TicTacToeState::Move best = parallelSearcher_->findBestMove(*pState, stop_.flag());
+        pState->move(best.row, best.column);
+        return;
+    }
+
+    // The negamax searcher searches the state in place and restores it, so the game state can be used directly. It deepens
+    // the search one ply at a time, so it always has a move to return when the budget runs out.
+    if (searcher_)
+    {
+        Searcher::Budget budget;
+        budget.time               = options_.timeBudget;
+        budget.nodes              = options_.nodeBudget;
+        budget.pStop              = stop_.flag();
+        TicTacToeState::Move best = searcher_->findBestMove(*pState, budget);
+        pState->move(best.row, best.column);
+        return;
+    }
+
+    // Find the best response to the current state. With canonical fingerprints, the states in the game tree are stored in the
+    // transposition table by their canonical fingerprints, so their values are shared with all of their symmetric forms.
     auto pCopy = std::make_shared<TicTacToeState>(*pState);
+    pCopy->useCanonicalFingerprint(options_.canonicalFingerprints);
     gameTree_->findBestResponse(std::static_pointer_cast<GamePlayer::GameState>(pCopy));
     auto pResponse = std::dynamic_pointer_cast<TicTacToeState>(pCopy->response_);
     assert(pResponse);
+    bool canonical = pState->usesCanonicalFingerprint();
     *pState = *pResponse;
-#if defined(ANALYSIS_TRANSPOSITION_TABLE)
-    json j = transpositionTable_->analysisData_.toJson();
-    std::cerr << j.dump(4) << std::endl;
-#endif
+    pState->useCanonicalFingerprint(canonical);
 }
 
 std::vector<GamePlayer::GameState *> ComputerPlayer::responseGenerator(GamePlayer::GameState const & state, int depth)
 {
+    TicTacToeState const * pTTTState = dynamic_cast<TicTacToeState const *>(&state);
+
+    TicTacToeState::MoveList moves;
+    pTTTState->generateMoves(&moves);
+
+    // The best moves are searched first so that more of the tree is pruned. GameTree chooses the first of the responses with
+    // the best value, so the responses to the root are left in index order to ensure that the same move is chosen. GameTree
+    // does not report cutoffs, so only the static ordering is used.
+    if (depth > 0)
+    {
+        moveOrdering_.order(*pTTTState, &moves, depth);
+    }
+
+    // GameTree takes ownership of the responses, so each one must be a separate object. They are allocated from a pool.
     std::vector<GamePlayer::GameState *> responses;
-    TicTacToeState const *               pTTTState = dynamic_cast<TicTacToeState const *>(&state);
-    for (int i = 0; i < 9; ++i)
+    responses.reserve(moves.size());
+    for (TicTacToeState::Move const & move : moves)
     {
-        if (pTTTState->board().at(i) == Board::Cell::NEITHER)
-        {
-            TicTacToeState * pResponse = new TicTacToeState(*pTTTState);
-            auto [r, c]                = Board::toPosition(i);
-            pResponse->move(r, c);
-            responses.push_back(pResponse);
-        }
+        TicTacToeState * pResponse = new Pooled<TicTacToeState>(*pTTTState);
+        pResponse->move(move.row, move.column);
+        responses.push_back(pResponse);
     }
+    generatedStates_ += responses.size();
     return responses;
 }
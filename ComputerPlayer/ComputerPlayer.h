@@ -1,29 +1,136 @@
 #pragma once
 
+#include "MoveOrdering.h"
+#include "SearchStatistics.h"
+#include "StopSignal.h"
+#include "TicTacToeEvaluator.h"
+
 #include "Components/Player.h"
 #include "TicTacToeState/TicTacToeState.h"
 
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
 namespace GamePlayer
 {
 class GameTree;
-class StaticEvaluator;
 class TranspositionTable;
 }
 
+class FlatTranspositionTable;
+template <typename State, typename Evaluator, typename Ordering, typename Table>
+class NegamaxSearch;
+template <typename State, typename Evaluator, typename Ordering>
+class ParallelSearch;
+template <typename State, typename Evaluator, typename Ordering>
+class LazySmpSearch;
+
 class ComputerPlayer : public Player
 {
 public:
+    // Search options
+    struct Options
+    {
+        // Search engines
+        enum class Engine
+        {
+            GAME_TREE, // GamePlayer::GameTree
+            NEGAMAX    // NegamaxSearch, which searches the state in place without virtual calls or allocations
+        };
+
+        // How the NEGAMAX engine uses more than one thread
+        enum class Parallelism
+        {
+            ROOT_SPLIT, // ParallelSearch: the threads divide the moves at the root
+            LAZY_SMP    // LazySmpSearch: the threads all search the whole tree, sharing a lock-free transposition table
+        };
+
+        // Search engine. Both engines return the same move.
+        Engine engine = Engine::GAME_TREE;
+
+        // If true, the transposition table stores one entry for all symmetric states (GAME_TREE only)
+        bool canonicalFingerprints = false;
+
+        // Maximum number of plies searched below the current state
+        int maxDepth = 8;
+
+        // Time allowed per move, or 0 for no limit (NEGAMAX only)
+        std::chrono::milliseconds timeBudget { 0 };
+
+        // Number of states searched per move, or 0 for no limit (NEGAMAX only)
+        uint64_t nodeBudget = 0;
+
+        // Number of threads that share the search, or 0 for one per hardware thread (NEGAMAX only)
+        int threads = 1;
+
+        // How more than one thread is used. A root split search searches to the maximum depth and does not use the budgets.
+        Parallelism parallelism = Parallelism::ROOT_SPLIT;
+    };
+
     // Constructor
     explicit ComputerPlayer(TicTacToeState::PlayerId playerId);
 
+    // Constructor
+    ComputerPlayer(TicTacToeState::PlayerId playerId, Options const & options);
+
+    // Destructor
+    virtual ~ComputerPlayer();
+
     // Gets a move from the computer and applies it to the game state. Overrides Player::move().
     virtual void move(TicTacToeState * pState) override;
 
-private:
+    // Finds the computer's move for each of the opponent's possible replies, so that the move is ready when the opponent
+    // replies. It must be the opponent's turn. Overrides Player::ponder().
+    virtual void ponder(TicTacToeState const & state) override;
 
-    GamePlayer::GameTree * gameTree_;                                    // Game tree for searching responses
-    std::shared_ptr<GamePlayer::StaticEvaluator>    staticEvaluator_;    // Static evaluator for the game tree
-    std::shared_ptr<GamePlayer::TranspositionTable> transpositionTable_; // Transposition table for the game tree
+    // Stops a move or pondering in progress on another thread as soon as possible. A move is still made, but it may not be
+    // the best. The GAME_TREE engine only stops between the replies when pondering. Overrides Player::cancel().
+    virtual void cancel() override;
+
+    // Forgets the replies found while pondering. Overrides Player::reset().
+    virtual void reset() override;
+
+    // Returns the counts of the work done to find the last move. The NEGAMAX engine reports all of the counts. The GAME_TREE
+    // engine only reports the states it generated and the elapsed time, since GameTree does not report its work. If the move
+    // was found while pondering, there are no counts.
+    SearchStatistics const & lastStatistics() const { return lastStatistics_; }
+
+    // Returns the counts of the work done by all moves and pondering since the player was created or resetStatistics() was
+    // called
+    SearchStatistics const & totalStatistics() const { return totalStatistics_; }
+
+    // Resets the counts of all moves
+    void resetStatistics() { totalStatistics_ = SearchStatistics(); }
 
+    // Returns the responses to a state, ordered for the search. This is the response generator used by the game tree. The
+    // caller owns the responses.
     std::vector<GamePlayer::GameState *> responseGenerator(GamePlayer::GameState const & state, int depth);
+
+private:
+    using Searcher         = NegamaxSearch<TicTacToeState, TicTacToeEvaluator, MoveOrdering, FlatTranspositionTable>;
+    using ParallelSearcher = ParallelSearch<TicTacToeState, TicTacToeEvaluator, MoveOrdering>;
+    using LazySmpSearcher  = LazySmpSearch<TicTacToeState, TicTacToeEvaluator, MoveOrdering>;
+
+    // Finds the best move with the selected engine, applies it to the game state, and returns the counts of the work done
+    SearchStatistics think(TicTacToeState * pState);
+
+    // Finds the best move with the selected engine and applies it to the game state
+    void search(TicTacToeState * pState);
+
+    Options                                         options_;            // Search options
+    std::unique_ptr<GamePlayer::GameTree>           gameTree_;           // Game tree for searching responses (GAME_TREE)
+    std::unique_ptr<Searcher>                       searcher_;           // Negamax searcher (NEGAMAX with one thread)
+    std::unique_ptr<ParallelSearcher>               parallelSearcher_;   // Root split searcher (NEGAMAX, ROOT_SPLIT)
+    std::unique_ptr<LazySmpSearcher>                lazySmpSearcher_;    // Lazy SMP searcher (NEGAMAX, LAZY_SMP)
+    std::shared_ptr<TicTacToeEvaluator>             staticEvaluator_;    // Static evaluator for either engine
+    std::shared_ptr<GamePlayer::TranspositionTable> transpositionTable_; // Transposition table for the game tree
+    MoveOrdering                                    moveOrdering_;       // Move ordering for the game tree
+    SearchStatistics                                lastStatistics_;     // Counts of the work done to find the last move
+    SearchStatistics                                totalStatistics_;    // Counts of the work done by all moves
+    std::unordered_map<int, int>                    replies_;            // Move for each state found while pondering, by index
+    uint64_t                                        generatedStates_;    // States generated by the game tree in a search
+    StopSignal                                      stop_;               // Stops the current move or pondering
 };
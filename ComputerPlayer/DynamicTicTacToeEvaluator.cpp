@@ -0,0 +1,45 @@
+#include "DynamicTicTacToeEvaluator.h"
+
+#include <algorithm>
+#include <cassert>
+
+// Returns 1 if the cell has an X, -1 if it has an O, and 0 if it is empty
+static int ownership(BoardCell cell)
+{
+    return (cell == BoardCell::X) ? 1 : (cell == BoardCell::O) ? -1 : 0;
+}
+
+float DynamicTicTacToeEvaluator::evaluate(GamePlayer::GameState const & state) const
+{
+    // Check if the state is a DynamicTicTacToeState
+    assert(dynamic_cast<State const *>(&state) != nullptr);
+    return evaluate(static_cast<State const &>(state));
+}
+
+float DynamicTicTacToeEvaluator::evaluate(State const & tttState) const
+{
+    DynamicBoard const & board = tttState.board();
+
+    // A board with an even number of rows or columns has 2 or 4 center cells
+    int rows    = board.rows();
+    int columns = board.columns();
+    int centers = 0;
+    for (int r = (rows - 1) / 2; r <= rows / 2; ++r)
+    {
+        for (int c = (columns - 1) / 2; c <= columns / 2; ++c)
+        {
+            centers += ownership(board.at(r, c));
+        }
+    }
+
+    // A board with one row or column has only 2 corners, and a board with one cell has only 1
+    int const cornerIndexes[4] = { 0, columns - 1, (rows - 1) * columns, rows * columns - 1 };
+    int       corners          = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        if (std::find(cornerIndexes, cornerIndexes + i, cornerIndexes[i]) == cornerIndexes + i)
+            corners += ownership(board.at(cornerIndexes[i]));
+    }
+
+    return value(tttState, centers, corners);
+}
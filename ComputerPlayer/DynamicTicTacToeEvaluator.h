@@ -0,0 +1,30 @@
+#pragma once
+
+#include "TicTacToeHeuristic.h"
+
+#include "TicTacToeState/DynamicTicTacToeState.h"
+
+namespace GamePlayer
+{
+class GameState;
+}
+
+// A static evaluation function for tic-tac-toe on a board whose size is chosen at run time.
+//
+// It computes the same heuristic as BasicTicTacToeEvaluator (see TicTacToeHeuristic), for states whose board is a
+// DynamicBoard. There is no table.
+class DynamicTicTacToeEvaluator : public TicTacToeHeuristic
+{
+public:
+    using State = DynamicTicTacToeState;
+
+    // Destructor.
+    virtual ~DynamicTicTacToeEvaluator() = default;
+
+    // Returns a value for the given tic-tac-toe state. Overrides StaticEvaluator::evaluate().
+    virtual float evaluate(GamePlayer::GameState const & state) const override;
+
+    // Returns a value for the given tic-tac-toe state. This is not virtual, so a search that knows the type of its evaluator
+    // can call it directly.
+    float evaluate(State const & state) const;
+};
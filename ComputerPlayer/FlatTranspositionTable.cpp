@@ -0,0 +1,13 @@
+#include "FlatTranspositionTable.h"
+
+#include <algorithm>
+
+FlatTranspositionTable::FlatTranspositionTable(size_t size)
+    : entries_(size, EMPTY)
+{
+}
+
+void FlatTranspositionTable::clear()
+{
+    std::fill(entries_.begin(), entries_.end(), EMPTY);
+}
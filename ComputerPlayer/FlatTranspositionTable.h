@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// A transposition table that is directly addressed by a dense, collision-free state index.
+//
+// Since every state has its own slot, there is no hashing, no probing and no verification. An entry is replaced whenever a
+// new result for its state is stored, and there are never any collisions or overwrites of other states' entries.
+class FlatTranspositionTable
+{
+public:
+    // How the value of an entry relates to the value of the state
+    enum class Bound : uint8_t
+    {
+        EXACT, // The value is the value of the state
+        LOWER, // The value of the state is at least the value
+        UPPER  // The value of the state is at most the value
+    };
+
+    // The result of a search of a state
+    struct Entry
+    {
+        float  value;    // Value of the state from the point of view of the player to move
+        int8_t depth;    // Remaining depth of the search that produced the entry, or -1 if the entry is empty
+        Bound  bound;    // How the value relates to the value of the state
+        int8_t bestMove; // Index of the cell of the best move, or -1 if there is none
+        bool   complete; // True if no line of play was cut off by the depth limit, so the value holds for any deeper search
+    };
+
+    // Constructor
+    explicit FlatTranspositionTable(size_t size);
+
+    // Returns the entry for the state with the specified index, or nullptr if there is none
+    Entry const * probe(int index) const
+    {
+        Entry const & entry = entries_[index];
+        return (entry.depth >= 0) ? &entry : nullptr;
+    }
+
+    // Stores the entry for the state with the specified index
+    void store(int index, Entry const & entry) { entries_[index] = entry; }
+
+    // Gets the entry for a state, which is identified by its index(). Returns false if there is none. If pCollision is not
+    // null, it is set to false, since a state's slot is never used by another state.
+    template <typename State>
+    bool probe(State const & state, Entry * pEntry, bool * pCollision = nullptr) const
+    {
+        Entry const * pFound = probe(state.index());
+        if (pFound)
+            *pEntry = *pFound;
+        if (pCollision)
+            *pCollision = false;
+        return pFound != nullptr;
+    }
+
+    // Stores the entry for a state, which is identified by its index(). Returns false, since the entry of another state is
+    // never replaced.
+    template <typename State>
+    bool store(State const & state, Entry const & entry)
+    {
+        store(state.index(), entry);
+        return false;
+    }
+
+    // Removes all entries
+    void clear();
+
+    // Returns the number of entries
+    size_t size() const { return entries_.size(); }
+
+private:
+    static Entry constexpr EMPTY = { 0.0f, -1, Bound::EXACT, -1, false };
+
+    std::vector<Entry> entries_; // The entries, indexed by state index
+};
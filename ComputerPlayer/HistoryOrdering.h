@@ -0,0 +1,99 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// Orders moves on a board of any size so that the moves most likely to be best are searched first.
+//
+// Unlike MoveOrdering, it knows nothing about the lines of the board, so it can be used with any state. The move from the
+// transposition table is first, then the killer move for the ply, and then the rest by their history scores, which
+// accumulate over all searches. Moves with equal scores keep the order of generateMoves(). The order only affects how much
+// is pruned, not the results of a search.
+//
+// The State must provide Move, MoveList, whoseTurn() and board(), whose toIndex(row, column) gives the index of a cell.
+template <typename State>
+class HistoryOrdering
+{
+public:
+    using Move     = typename State::Move;
+    using MoveList = typename State::MoveList;
+    using PlayerId = typename State::PlayerId;
+
+    // Sorts the moves, best first. The ply is the distance from the root, and the hash move is the index of the cell of the
+    // best move found by a previous search of the state, or -1 if there is none.
+    void order(State const & state, MoveList * pMoves, int ply, int hashMove = -1) const
+    {
+        std::vector<uint32_t> const & history = history_[playerIndex(state.whoseTurn())];
+        int                           killer  = this->killer(ply);
+        auto                          key     = [&] (Move const & move) {
+            int index = state.board().toIndex(move.row, move.column);
+            if (index == hashMove)
+                return HASH;
+            if (index == killer)
+                return KILLER;
+            return (index < static_cast<int>(history.size())) ? history[index] : 0u;
+        };
+        std::stable_sort(pMoves->begin(), pMoves->end(), [&key] (Move const & a, Move const & b) {
+            return key(a) > key(b);
+        });
+    }
+
+    // Records a move that caused a cutoff at the specified ply with the specified remaining depth
+    void cutoff(State const & state, Move const & move, int ply, int depth)
+    {
+        int index = state.board().toIndex(move.row, move.column);
+        if (ply >= static_cast<int>(killers_.size()))
+            killers_.resize(ply + 1, -1);
+        killers_[ply] = index;
+
+        // Deeper cutoffs prune more, so they count for more. The scores are halved when they get too large, which also lets
+        // recent searches outweigh old ones.
+        std::vector<uint32_t> & history = history_[playerIndex(state.whoseTurn())];
+        if (index >= static_cast<int>(history.size()))
+            history.resize(index + 1, 0);
+        history[index] += static_cast<uint32_t>(depth * depth);
+        if (history[index] > MAX_HISTORY)
+        {
+            for (auto & scores : history_)
+            {
+                for (uint32_t & score : scores)
+                {
+                    score /= 2;
+                }
+            }
+        }
+    }
+
+    // Forgets all history and killer moves
+    void clear()
+    {
+        for (auto & scores : history_)
+        {
+            scores.clear();
+        }
+        killers_.clear();
+    }
+
+    // Returns the history score of a move to the cell with the specified index by the specified player
+    uint32_t history(PlayerId player, int index) const
+    {
+        std::vector<uint32_t> const & scores = history_[playerIndex(player)];
+        return (index < static_cast<int>(scores.size())) ? scores[index] : 0;
+    }
+
+    // Returns the killer move for the specified ply, or -1 if there is none
+    int killer(int ply) const { return (ply < static_cast<int>(killers_.size())) ? killers_[ply] : -1; }
+
+private:
+    // History scores are limited so that they are always below the keys of the hash and killer moves
+    static uint32_t constexpr MAX_HISTORY = (1u << 24) - 1;
+    static uint32_t constexpr KILLER      = MAX_HISTORY + 1;
+    static uint32_t constexpr HASH        = MAX_HISTORY + 2;
+
+    static int playerIndex(PlayerId player) { return (player == PlayerId::ALICE) ? 0 : 1; }
+
+    std::array<std::vector<uint32_t>, 2> history_; // History scores, indexed by player and cell, and grown as needed
+    std::vector<int>                     killers_; // Killer moves, indexed by ply, and grown as needed
+};
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "NegamaxSearch.h"
+#include "SharedTranspositionTable.h"
+#include "ThreadPool.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+// A Lazy SMP search: several threads run the same iterative-deepening search of the same state, sharing a lock-free
+// transposition table.
+//
+// The threads coordinate only through the table. Helper threads fill it with results that the main thread then finds
+// instead of searching for itself, and every other helper starts one ply deeper so that the helpers do not all follow the
+// main thread in lockstep. When the main thread finishes, the helpers are stopped and the main thread's move is returned.
+//
+// The entries in the table are valid no matter which thread stored them, so the main thread finds the same values, and
+// therefore the same move, as a serial search to the same depth. Only the amount of work it does depends on the timing of
+// the other threads.
+template <typename State, typename Evaluator, typename Ordering>
+class LazySmpSearch
+{
+public:
+    using Searcher   = NegamaxSearch<State, Evaluator, Ordering, SharedTranspositionTable>;
+    using Move       = typename State::Move;
+    using Budget     = typename Searcher::Budget;
+    using Statistics = typename Searcher::Statistics;
+
+    // Constructor. The maximum depth is the number of plies searched below the root. The table size is the minimum number of
+    // entries in the shared table. If the number of threads is 0, the number of hardware threads is used.
+    LazySmpSearch(Evaluator const & evaluator, int maxDepth, size_t tableSize, int numberOfThreads = 0)
+        : pool_(numberOfThreads)
+        , table_(std::make_shared<SharedTranspositionTable>(tableSize))
+    {
+        for (int i = 0; i < pool_.size(); ++i)
+        {
+            searchers_.push_back(std::make_unique<Searcher>(evaluator, maxDepth, table_));
+        }
+    }
+
+    // Returns the best move for the player to move, found by iterative deepening within the budget (which applies to the
+    // main thread). The game must not be over.
+    Move findBestMove(State const & state, Budget const & budget = Budget())
+    {
+        Move              best;
+        std::atomic<bool> stop(false);
+        pool_.run([&](int thread) {
+            State copy(state);
+            if (thread == 0)
+            {
+                best = searchers_[0]->findBestMove(copy, budget);
+                stop = true;
+            }
+            else
+            {
+                Budget helperBudget;
+                helperBudget.pStop = &stop;
+                searchers_[thread]->findBestMove(copy, helperBudget, 1 + thread % 2);
+            }
+        });
+        return best;
+    }
+
+    // Returns the depth of the deepest search completed by the main thread in the last call to findBestMove()
+    int completedDepth() const { return searchers_[0]->completedDepth(); }
+
+    // Returns the counts of all of the threads, accumulated since the last call to resetStatistics()
+    Statistics statistics() const
+    {
+        Statistics total;
+        for (auto const & searcher : searchers_)
+        {
+            total += searcher->statistics();
+        }
+        return total;
+    }
+
+    // Resets the counts
+    void resetStatistics()
+    {
+        for (auto & searcher : searchers_)
+        {
+            searcher->resetStatistics();
+        }
+    }
+
+    // Returns the number of threads
+    int numberOfThreads() const { return pool_.size(); }
+
+    // Returns the shared transposition table
+    SharedTranspositionTable const & table() const { return *table_; }
+
+private:
+    ThreadPool                                pool_;      // The threads
+    std::shared_ptr<SharedTranspositionTable> table_;     // The transposition table shared by the threads
+    std::vector<std::unique_ptr<Searcher>>    searchers_; // A searcher for each thread
+};
@@ -0,0 +1,108 @@
+#include "MoveOrdering.h"
+
+#include "Components/Board.h"
+#include "Components/Tables.h"
+
+#include <cassert>
+
+MoveOrdering::MoveOrdering()
+{
+    clear();
+}
+
+void MoveOrdering::order(TicTacToeState const & state, TicTacToeState::MoveList * pMoves, int ply, int hashMove) const
+{
+    std::array<uint32_t, TicTacToeState::MoveList::CAPACITY> keys;
+
+    int player = playerIndex(state.whoseTurn());
+    int killer = this->killer(ply);
+    int n      = pMoves->size();
+    for (int i = 0; i < n; ++i)
+    {
+        TicTacToeState::Move const & move  = (*pMoves)[i];
+        int                          index = Board::toIndex(move.row, move.column);
+        uint32_t                     c     = (index == hashMove) ? HASH : category(state, index);
+        if (c < KILLER && index == killer)
+            c = KILLER;
+        keys[i] = (c << 24) | history_[player][index];
+    }
+
+    // Insertion sort, which is stable, so moves with equal keys stay in index order
+    for (int i = 1; i < n; ++i)
+    {
+        TicTacToeState::Move move = (*pMoves)[i];
+        uint32_t             key  = keys[i];
+        int                  j    = i;
+        for (; j > 0 && keys[j - 1] < key; --j)
+        {
+            (*pMoves)[j] = (*pMoves)[j - 1];
+            keys[j]      = keys[j - 1];
+        }
+        (*pMoves)[j] = move;
+        keys[j]      = key;
+    }
+}
+
+void MoveOrdering::cutoff(TicTacToeState const & state, TicTacToeState::Move const & move, int ply, int depth)
+{
+    int index = Board::toIndex(move.row, move.column);
+    if (ply < MAX_PLY)
+        killers_[ply] = static_cast<int8_t>(index);
+
+    // Deeper cutoffs prune more, so they count for more. The scores are halved when they get too large, which also lets
+    // recent searches outweigh old ones.
+    auto & history = history_[playerIndex(state.whoseTurn())];
+    history[index] += static_cast<uint32_t>(depth * depth);
+    if (history[index] > MAX_HISTORY)
+    {
+        for (auto & scores : history_)
+        {
+            for (uint32_t & score : scores)
+            {
+                score /= 2;
+            }
+        }
+    }
+}
+
+void MoveOrdering::clear()
+{
+    for (auto & scores : history_)
+    {
+        scores.fill(0);
+    }
+    killers_.fill(-1);
+}
+
+MoveOrdering::Category MoveOrdering::category(TicTacToeState const & state, int index)
+{
+    assert(index >= 0 && index < 9);
+
+    Board const & board = state.board();
+    assert(board.at(index) == Board::Cell::NEITHER);
+
+    Board::Cell me       = TicTacToeState::toCell(state.whoseTurn());
+    Board::Cell opponent = (me == Board::Cell::X) ? Board::Cell::O : Board::Cell::X;
+    Board::Mask bit      = Board::Mask(1u << index);
+
+    if (Board::hasLine(board.mask(me) | bit))
+        return WIN;
+    if (Board::hasLine(board.mask(opponent) | bit))
+        return BLOCK;
+
+    // A fork is a move that makes two in a line in at least two lines that the opponent has not blocked
+    Tables::LinesThrough const & through = Tables::LINES_THROUGH[index];
+    int                          threats = 0;
+    for (int i = 0; i < through.count; ++i)
+    {
+        int line = through.lines[i];
+        if (state.lineCount(line, me) == 1 && state.lineCount(line, opponent) == 0)
+            ++threats;
+    }
+    if (threats >= 2)
+        return FORK;
+
+    if (index == 4)
+        return CENTER;
+    return (index % 2 == 0) ? CORNER : EDGE;
+}
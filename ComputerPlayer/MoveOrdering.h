@@ -0,0 +1,63 @@
+#pragma once
+
+#include "TicTacToeState/TicTacToeState.h"
+
+#include <array>
+#include <cstdint>
+
+// Orders moves so that the moves most likely to be best are searched first, which lets alpha-beta prune more of the tree.
+//
+// Moves are ranked by category: the move from the transposition table, then moves that win, moves that block a win, the
+// killer move for the ply, moves that create a fork, and finally the center, the corners and the edges. Within a category,
+// moves are ranked by their history scores, which accumulate over all searches. The order only affects how much is pruned,
+// not the results of a search.
+class MoveOrdering
+{
+public:
+    // Move categories, from worst to best
+    enum Category
+    {
+        EDGE,
+        CORNER,
+        CENTER,
+        FORK,   // Creates two open lines with two in a line
+        KILLER, // Caused a cutoff at the same ply
+        BLOCK,  // Blocks the opponent's three in a line
+        WIN,    // Completes three in a line
+        HASH    // Best move found by a previous search
+    };
+
+    // Maximum number of plies that killer moves are kept for
+    static int constexpr MAX_PLY = 9;
+
+    // Constructor
+    MoveOrdering();
+
+    // Sorts the moves, best first. The ply is the distance from the root, and the hash move is the index of the cell of the
+    // best move found by a previous search of the state, or -1 if there is none.
+    void order(TicTacToeState const & state, TicTacToeState::MoveList * pMoves, int ply, int hashMove = -1) const;
+
+    // Records a move that caused a cutoff at the specified ply with the specified remaining depth
+    void cutoff(TicTacToeState const & state, TicTacToeState::Move const & move, int ply, int depth);
+
+    // Forgets all history and killer moves
+    void clear();
+
+    // Returns the category of a move to the cell with the specified index, ignoring hash and killer moves
+    static Category category(TicTacToeState const & state, int index);
+
+    // Returns the history score of a move to the cell with the specified index by the specified player
+    uint32_t history(TicTacToeState::PlayerId player, int index) const { return history_[playerIndex(player)][index]; }
+
+    // Returns the killer move for the specified ply, or -1 if there is none
+    int killer(int ply) const { return (ply < MAX_PLY) ? killers_[ply] : -1; }
+
+private:
+    // History scores are limited so that they fit below the category in a sort key
+    static uint32_t constexpr MAX_HISTORY = (1u << 24) - 1;
+
+    static int playerIndex(TicTacToeState::PlayerId player) { return (player == TicTacToeState::PlayerId::ALICE) ? 0 : 1; }
+
+    std::array<std::array<uint32_t, 9>, 2> history_; // History scores, indexed by player and cell
+    std::array<int8_t, MAX_PLY>            killers_; // Killer moves, indexed by ply
+};
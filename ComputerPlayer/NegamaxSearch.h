@@ -0,0 +1,345 @@
+#pragma once
+
+#include "FlatTranspositionTable.h"
+#include "SearchStatistics.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+// A depth-limited alpha-beta negamax search.
+//
+// The search works directly on a state with make/unmake, so it does not copy or allocate states, and it calls the state and
+// the evaluator without going through virtual functions. Results are cached in a transposition table, which is normally a
+// FlatTranspositionTable owned by the search. A table can instead be shared by several searches, which is how the threads
+// of a LazySmpSearch help each other.
+//
+// The State must provide Move, MoveList, NUMBER_OF_INDEXES, generateMoves(), move(row, column), unmove(), isDone(),
+// whoseTurn() and board(), whose toIndex(row, column) gives the index of a cell, and whatever the Table uses to identify a
+// state. The Evaluator must provide evaluate(State const &), which returns a value that is positive when it favors Alice.
+// The Ordering must provide order(State const &, MoveList *, ply, hashMove), which sorts the moves best first, and
+// cutoff(State const &, Move const &, ply, depth), which is told about each move that causes a cutoff. The ordering
+// persists across searches. The Table must provide Entry, Bound, probe(State const &, Entry *, bool * pCollision), and
+// store(State const &, Entry const &), which returns true if it replaced the entry of another state.
+//
+// The best move is the first move (in the order of generateMoves()) with the highest minimax value, so the result is the
+// same as a plain minimax search to the same depth, regardless of the order in which the moves are searched.
+template <typename State, typename Evaluator, typename Ordering, typename Table = FlatTranspositionTable>
+class NegamaxSearch
+{
+public:
+    using Move     = typename State::Move;
+    using MoveList = typename State::MoveList;
+
+    // Limits on a search. A limit of zero means there is no limit.
+    struct Budget
+    {
+        // Wall-clock time
+        std::chrono::steady_clock::duration time = std::chrono::steady_clock::duration::zero();
+
+        // Number of states searched
+        uint64_t nodes = 0;
+
+        // If not null, the search stops when this becomes true. This is not a limit, so it applies even if there are none.
+        std::atomic<bool> const * pStop = nullptr;
+    };
+
+    // Counts of the work done by searches. The search does not measure the elapsed time.
+    using Statistics = SearchStatistics;
+
+    // Deepest search, since the depth of a search is stored in a table entry
+    static int constexpr MAX_DEPTH = std::numeric_limits<int8_t>::max();
+
+    // Constructor. The maximum depth is the number of plies searched below the root, or the deepest search made by iterative
+    // deepening.
+    NegamaxSearch(Evaluator const & evaluator, int maxDepth)
+        : evaluator_(evaluator)
+        , maxDepth_(maxDepth)
+        , table_(std::make_shared<Table>(State::NUMBER_OF_INDEXES))
+        , aborted_(false)
+        , completedDepth_(0)
+        , timed_(false)
+        , nodeLimit_(0)
+        , pStop_(nullptr)
+    {
+        assert(maxDepth > 0 && maxDepth <= MAX_DEPTH);
+    }
+
+    // Constructor. The transposition table may be shared with other searches, which can be running on other threads if the
+    // table supports it.
+    NegamaxSearch(Evaluator const & evaluator, int maxDepth, std::shared_ptr<Table> table)
+        : evaluator_(evaluator)
+        , maxDepth_(maxDepth)
+        , table_(std::move(table))
+        , aborted_(false)
+        , completedDepth_(0)
+        , timed_(false)
+        , nodeLimit_(0)
+        , pStop_(nullptr)
+    {
+        assert(maxDepth > 0 && maxDepth <= MAX_DEPTH);
+        assert(table_);
+    }
+
+    // Returns the best move for the player to move, searched to the maximum depth. The state is searched in place and is
+    // restored before returning. The game must not be over.
+    Move findBestMove(State & state)
+    {
+        startSearch(Budget());
+        return searchRoot(state, maxDepth_, -1).move;
+    }
+
+    // Returns the best move for the player to move, found by searching to increasing depths until the maximum depth is
+    // reached, the result can no longer change, or the budget runs out. The move from the deepest completed search is
+    // returned. If the budget runs out before any search completes, the first move in the move ordering is returned. Each
+    // search reuses the results of the previous ones in the transposition table. Normally the first search is 1 ply deep,
+    // but a helper in a parallel search may start deeper so that it does not duplicate the work of the other threads.
+    Move findBestMove(State & state, Budget const & budget, int firstDepth = 1)
+    {
+        startSearch(budget);
+
+        MoveList moves;
+        state.generateMoves(&moves);
+        assert(!moves.empty());
+        ordering_.order(state, &moves, 0, -1);
+        Move best = moves[0];
+
+        for (int depth = firstDepth; depth <= maxDepth_; ++depth)
+        {
+            RootResult result = searchRoot(state, depth, state.board().toIndex(best.row, best.column));
+            if (aborted_)
+                break;
+            best            = result.move;
+            completedDepth_ = depth;
+            if (result.complete)
+                break; // Every line of play reached the end of the game, so a deeper search would return the same move
+        }
+        return best;
+    }
+
+    // Returns the value of a move for the player to move, searched to the maximum depth. If the value is not greater than
+    // alpha, only an upper bound on it is returned. The state is restored before returning. A parallel search uses this to
+    // search the moves at the root separately. If pStop is not null, the search stops when it becomes true, and the value is
+    // meaningless.
+    float searchMove(State & state, Move const & move, float alpha, std::atomic<bool> const * pStop = nullptr)
+    {
+        Budget budget;
+        budget.pStop = pStop;
+        startSearch(budget);
+        state.move(move.row, move.column);
+        float value = -search(state, maxDepth_ - 1, 1, -INFINITE, -alpha).value;
+        state.unmove();
+        return value;
+    }
+
+    // Removes all results from the transposition table and resets the move ordering
+    void clear()
+    {
+        table_->clear();
+        ordering_.clear();
+    }
+
+    // Returns the move ordering
+    Ordering const & ordering() const { return ordering_; }
+
+    // Returns the counts accumulated since the last call to resetStatistics()
+    Statistics const & statistics() const { return statistics_; }
+
+    // Resets the counts
+    void resetStatistics() { statistics_ = Statistics(); }
+
+    // Returns the depth of the deepest search completed by the last call to findBestMove()
+    int completedDepth() const { return completedDepth_; }
+
+    // Returns true if the last call to findBestMove() ran out of budget
+    bool aborted() const { return aborted_; }
+
+private:
+    using Entry = typename Table::Entry;
+    using Bound = typename Table::Bound;
+
+    // The result of searching a state
+    struct Result
+    {
+        float value;    // Value from the point of view of the player to move
+        bool  complete; // True if no line of play was cut off by the depth limit
+    };
+
+    // The result of searching the root
+    struct RootResult
+    {
+        Move move;     // Best move
+        bool complete; // True if no line of play was cut off by the depth limit
+    };
+
+    using Clock = std::chrono::steady_clock;
+
+    static float constexpr INFINITE = std::numeric_limits<float>::infinity();
+
+    // Reading the clock is relatively expensive, so it is only checked once per this many states
+    static uint64_t constexpr CLOCK_CHECK_INTERVAL = 1024;
+
+    // Prepares for a search with the specified budget
+    void startSearch(Budget const & budget)
+    {
+        aborted_        = false;
+        completedDepth_ = 0;
+        timed_          = budget.time > Clock::duration::zero();
+        deadline_       = timed_ ? Clock::now() + budget.time : Clock::time_point();
+        nodeLimit_      = (budget.nodes > 0) ? statistics_.nodes + budget.nodes : 0;
+        pStop_          = budget.pStop;
+    }
+
+    // Returns true if the budget has run out. Once it has, the search is aborted.
+    bool outOfBudget()
+    {
+        if (!aborted_)
+        {
+            if (nodeLimit_ > 0 && statistics_.nodes >= nodeLimit_)
+                aborted_ = true;
+            else if (pStop_ && pStop_->load(std::memory_order_relaxed))
+                aborted_ = true;
+            else if (timed_ && statistics_.nodes % CLOCK_CHECK_INTERVAL == 0 && Clock::now() >= deadline_)
+                aborted_ = true;
+        }
+        return aborted_;
+    }
+
+    // Returns the best move at the root searched to the specified depth. The hash move is the index of the cell of the move
+    // to search first, or -1 if there is none. If the search is aborted, the result is meaningless.
+    RootResult searchRoot(State & state, int depth, int hashMove)
+    {
+        MoveList moves;
+        state.generateMoves(&moves);
+        assert(!moves.empty());
+        ordering_.order(state, &moves, 0, hashMove);
+
+        // Every value is finite, so the first move searched always replaces the best move, unless the search is aborted
+        ++statistics_.nodes;
+        float beta      = INFINITE;
+        float bestValue = -INFINITE;
+        Move  bestMove  = {};
+        int   bestIndex = std::numeric_limits<int>::max();
+        bool  complete  = true;
+        for (Move const & move : moves)
+        {
+            // A move that ties the best value replaces it if it comes first in index order, so the window of a move with a
+            // lower index is widened just enough that a tie is seen as a tie instead of as a cutoff.
+            int   index = state.board().toIndex(move.row, move.column);
+            float alpha = (index < bestIndex) ? std::nextafter(bestValue, -INFINITE) : bestValue;
+            state.move(move.row, move.column);
+            Result result = search(state, depth - 1, 1, -beta, -alpha);
+            state.unmove();
+            if (aborted_)
+                break;
+
+            float value = -result.value;
+            complete    = complete && result.complete;
+            if (value > bestValue || (value == bestValue && index < bestIndex))
+            {
+                bestValue = value;
+                bestMove  = move;
+                bestIndex = index;
+            }
+        }
+        return { bestMove, complete };
+    }
+
+    // Returns the value of a state from the point of view of the player to move
+    float evaluate(State const & state) const
+    {
+        float value = evaluator_.evaluate(state);
+        return (state.whoseTurn() == State::PlayerId::ALICE) ? value : -value;
+    }
+
+    // Returns the value of the state searched to the specified depth, within the window (alpha, beta). The ply is the
+    // distance from the root.
+    Result search(State & state, int depth, int ply, float alpha, float beta)
+    {
+        ++statistics_.nodes;
+        if (outOfBudget())
+            return { 0.0f, false };
+
+        if (state.isDone() || depth == 0)
+        {
+            ++statistics_.leaves;
+            return { evaluate(state), state.isDone() };
+        }
+
+        // If this state has been searched to the same depth, or completely to a shallower depth, the result can be used.
+        Entry entry;
+        bool  collision;
+        bool  found = table_->probe(state, &entry, &collision);
+        ++statistics_.probes;
+        statistics_.hits += found;
+        statistics_.collisions += collision;
+        if (found && (entry.depth == depth || (entry.complete && entry.depth <= depth)))
+        {
+            if (entry.bound == Bound::EXACT)
+                return { entry.value, entry.complete };
+            if (entry.bound == Bound::LOWER)
+                alpha = std::max(alpha, entry.value);
+            else
+                beta = std::min(beta, entry.value);
+            if (alpha >= beta)
+                return { entry.value, entry.complete };
+        }
+
+        MoveList moves;
+        state.generateMoves(&moves);
+        ordering_.order(state, &moves, ply, found ? entry.bestMove : -1);
+
+        float originalAlpha = alpha;
+        float bestValue     = -INFINITE;
+        int   bestMove      = -1;
+        bool  complete      = true;
+        for (Move const & move : moves)
+        {
+            state.move(move.row, move.column);
+            Result result = search(state, depth - 1, ply + 1, -beta, -alpha);
+            state.unmove();
+            if (aborted_)
+                return { 0.0f, false }; // The result is incomplete, so it must not be stored
+
+            complete = complete && result.complete;
+            if (-result.value > bestValue)
+            {
+                bestValue = -result.value;
+                bestMove  = state.board().toIndex(move.row, move.column);
+            }
+            alpha = std::max(alpha, bestValue);
+            if (alpha >= beta)
+            {
+                statistics_.cutoff(ply);
+                ordering_.cutoff(state, move, ply, depth);
+                break;
+            }
+        }
+
+        // A table entry only has room for the index of a cell on a board of up to 128 cells, so on a bigger board a best move
+        // with a higher index is not stored
+        Bound bound = (bestValue <= originalAlpha) ? Bound::UPPER : (bestValue >= beta) ? Bound::LOWER : Bound::EXACT;
+        if (bestMove > std::numeric_limits<int8_t>::max())
+            bestMove = -1;
+        statistics_.overwrites +=
+            table_->store(state, { bestValue, static_cast<int8_t>(depth), bound, static_cast<int8_t>(bestMove), complete });
+        return { bestValue, complete };
+    }
+
+    Evaluator const &         evaluator_;      // Static evaluator for the leaves
+    int                       maxDepth_;       // Number of plies searched below the root
+    std::shared_ptr<Table>    table_;          // Results of previous searches
+    Ordering                  ordering_;       // Move ordering, including what it has learned from previous searches
+    Statistics                statistics_;     // Counts of the work done by searches
+    bool                      aborted_;        // True if the current search has run out of budget
+    int                       completedDepth_; // Depth of the deepest completed search
+    bool                      timed_;          // True if the current search has a time limit
+    Clock::time_point         deadline_;       // Time at which the current search runs out of time
+    uint64_t                  nodeLimit_;      // Node count at which the current search runs out of nodes, or 0 if none
+    std::atomic<bool> const * pStop_;          // If not null, the current search stops when this becomes true
+};
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "NegamaxSearch.h"
+#include "ThreadPool.h"
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+// A negamax search that splits the moves at the root across a pool of threads.
+//
+// Each thread has its own NegamaxSearch, with its own transposition table and move ordering, so the threads share nothing
+// while searching a move except the best value found so far at the root. A thread claims the next unsearched root move,
+// searches it with that value as its lower bound, and raises the value if the move is better.
+//
+// Every move is searched with a lower bound just below the shared value, so a move that ties the best value gets its exact
+// value. The best move is then the first move in index order with the highest value, which is the same move as the serial
+// search regardless of how the moves are divided among the threads.
+template <typename State, typename Evaluator, typename Ordering>
+class ParallelSearch
+{
+public:
+    using Searcher   = NegamaxSearch<State, Evaluator, Ordering>;
+    using Move       = typename State::Move;
+    using MoveList   = typename State::MoveList;
+    using Statistics = typename Searcher::Statistics;
+
+    // Constructor. The maximum depth is the number of plies searched below the root. If the number of threads is 0, the
+    // number of hardware threads is used.
+    ParallelSearch(Evaluator const & evaluator, int maxDepth, int numberOfThreads = 0)
+        : pool_(numberOfThreads)
+        , rootNodes_(0)
+    {
+        for (int i = 0; i < pool_.size(); ++i)
+        {
+            searchers_.push_back(std::make_unique<Searcher>(evaluator, maxDepth));
+        }
+    }
+
+    // Returns the best move for the player to move, searched to the maximum depth. The game must not be over. If pStop is not
+    // null, the search stops when it becomes true, and the move returned is the best of the moves whose searches finished,
+    // or the first move in the move ordering if none did.
+    Move findBestMove(State const & state, std::atomic<bool> const * pStop = nullptr)
+    {
+        MoveList moves;
+        state.generateMoves(&moves);
+        assert(!moves.empty());
+
+        // The best moves are claimed first, so that good bounds are shared early
+        ordering_.order(state, &moves, 0, -1);
+        ++rootNodes_;
+
+        std::array<float, MoveList::CAPACITY> values;
+        std::atomic<int>                      next(0);
+        std::atomic<float>                    best(-INFINITE);
+        values.fill(-INFINITE); // A move whose search is not finished because the search is stopped is never chosen
+        pool_.run([&](int thread) {
+            State      copy(state);
+            Searcher & searcher = *searchers_[thread];
+            for (int i = next++; i < moves.size(); i = next++)
+            {
+                if (pStop && pStop->load(std::memory_order_relaxed))
+                    break;
+                float alpha = std::nextafter(best.load(), -INFINITE);
+                float value = searcher.searchMove(copy, moves[i], alpha, pStop);
+                if (pStop && pStop->load(std::memory_order_relaxed))
+                    break; // The search of the move may have been stopped, so its value is meaningless
+                values[i] = value;
+                raise(&best, value);
+            }
+        });
+
+        // If no move was searched, the first move in the move ordering is returned
+        int bestMove  = 0;
+        int bestIndex = state.board().toIndex(moves[0].row, moves[0].column);
+        for (int i = 1; i < moves.size(); ++i)
+        {
+            int  index = state.board().toIndex(moves[i].row, moves[i].column);
+            bool tie = values[i] == values[bestMove] && values[i] > -INFINITE;
+            if (values[i] > values[bestMove] || (tie && index < bestIndex))
+            {
+                bestMove  = i;
+                bestIndex = index;
+            }
+        }
+        return moves[bestMove];
+    }
+
+    // Returns the counts of all of the threads, accumulated since the last call to resetStatistics()
+    Statistics statistics() const
+    {
+        Statistics total;
+        total.nodes = rootNodes_;
+        for (auto const & searcher : searchers_)
+        {
+            total += searcher->statistics();
+        }
+        return total;
+    }
+
+    // Resets the counts
+    void resetStatistics()
+    {
+        rootNodes_ = 0;
+        for (auto & searcher : searchers_)
+        {
+            searcher->resetStatistics();
+        }
+    }
+
+    // Returns the number of threads
+    int numberOfThreads() const { return pool_.size(); }
+
+private:
+    static float constexpr INFINITE = std::numeric_limits<float>::infinity();
+
+    // Raises the shared value to the specified value if it is higher
+    static void raise(std::atomic<float> * pBest, float value)
+    {
+        float current = pBest->load();
+        while (value > current && !pBest->compare_exchange_weak(current, value))
+        {
+        }
+    }
+
+    ThreadPool                             pool_;      // Threads that search the root moves
+    std::vector<std::unique_ptr<Searcher>> searchers_; // A searcher for each thread
+    Ordering                               ordering_;  // Orders the root moves
+    uint64_t                               rootNodes_; // Number of roots searched
+};
@@ -0,0 +1,45 @@
+#include "QubicEvaluator.h"
+
+#include <cassert>
+
+float QubicEvaluator::evaluate(GamePlayer::GameState const & state) const
+{
+    // Check if the state is a QubicState
+    assert(dynamic_cast<State const *>(&state) != nullptr);
+    return evaluate(static_cast<State const &>(state));
+}
+
+float QubicEvaluator::evaluate(State const & qubicState) const
+{
+    // If there are 4 Xs or 4 Os in a row, return the corresponding win value
+    if (qubicState.winner() == BoardCell::X)
+    {
+        return WIN_VALUE;
+    }
+    if (qubicState.winner() == BoardCell::O)
+    {
+        return -WIN_VALUE;
+    }
+
+    // If the game is a draw, return 0
+    if (qubicState.isDraw())
+    {
+        return 0.0f;
+    }
+
+    // Sum the values of the lines that only one player can complete. Lines with marks of both players are worth nothing.
+    State::Mask xs    = qubicState.mask(BoardCell::X);
+    State::Mask os    = qubicState.mask(BoardCell::O);
+    float       score = 0.0f;
+    for (State::Mask line : State::Geometry::LINES)
+    {
+        State::Mask x = xs & line;
+        State::Mask o = os & line;
+        if (o == 0)
+            score += LINE_VALUES[State::count(x)];
+        else if (x == 0)
+            score -= LINE_VALUES[State::count(o)];
+    }
+
+    return score;
+}
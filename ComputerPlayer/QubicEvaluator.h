@@ -0,0 +1,45 @@
+#pragma once
+
+#include "GamePlayer/StaticEvaluator.h"
+#include "TicTacToeState/QubicState.h"
+
+#include <array>
+
+namespace GamePlayer
+{
+class GameState;
+}
+
+// A static evaluation function for Qubic.
+//
+// Each of the 76 lines that still can be completed by only one player is worth more the more of that player's marks it
+// holds, so a line with 3 marks (a threat) outweighs many lines with 1. The cells on 7 lines are worth more than the cells
+// on 4 simply because they are in more lines.
+class QubicEvaluator : public GamePlayer::StaticEvaluator
+{
+public:
+    using State = QubicState;
+
+    // Destructor.
+    virtual ~QubicEvaluator() = default;
+
+    // Returns a value for the given Qubic state. Overrides StaticEvaluator::evaluate().
+    virtual float evaluate(GamePlayer::GameState const & state) const override;
+
+    // Returns a value for the given Qubic state. This is not virtual, so a search that knows the type of its evaluator can
+    // call it directly.
+    float evaluate(State const & state) const;
+
+    // Returns the value of a winning state for Alice. Overrides StaticEvaluator::aliceWinsValue().
+    virtual float aliceWinsValue() const override { return WIN_VALUE; }
+
+    // Returns the value of a winning state for Bob. Overrides StaticEvaluator::bobWinsValue().
+    virtual float bobWinsValue() const override { return -WIN_VALUE; }
+
+private:
+    // Value constants for evaluation
+    static float constexpr WIN_VALUE = 10000.0f;
+
+    // Value of a line that only one player can complete, indexed by the number of that player's marks in it
+    static constexpr std::array<float, State::SIZE> LINE_VALUES = { 0.0f, 1.0f, 10.0f, 100.0f };
+};
@@ -0,0 +1,79 @@
+#include "QubicResponseGenerator.h"
+
+#include "StatePool.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+
+// Returns the number of lines through the cell that can still be completed by either player, which is how much a mark there
+// adds to the player's position or takes away from the opponent's
+static int liveLinesThrough(QubicState const & state, int index)
+{
+    QubicState::Mask                           xs      = state.mask(BoardCell::X);
+    QubicState::Mask                           os      = state.mask(BoardCell::O);
+    QubicState::Geometry::LinesThrough const & through = QubicState::Geometry::LINES_THROUGH[index];
+    int                                        live    = 0;
+    for (int i = 0; i < through.count; ++i)
+    {
+        QubicState::Mask line = QubicState::Geometry::LINES[through.lines[i]];
+        if ((xs & line) == 0 || (os & line) == 0)
+            ++live;
+    }
+    return live;
+}
+
+QubicResponseGenerator::QubicResponseGenerator()
+    : generatedStates_(0)
+{
+}
+
+std::vector<GamePlayer::GameState *> QubicResponseGenerator::operator ()(GamePlayer::GameState const & state, int /* depth */)
+{
+    QubicState const * pQubicState = dynamic_cast<QubicState const *>(&state);
+    assert(pQubicState);
+
+    QubicState::MoveList moves;
+    generate(*pQubicState, &moves);
+
+    // GameTree takes ownership of the responses, so each one must be a separate object. They are allocated from a pool.
+    std::vector<GamePlayer::GameState *> responses;
+    responses.reserve(moves.size());
+    for (QubicState::Move const & move : moves)
+    {
+        QubicState * pResponse = new Pooled<QubicState>(*pQubicState);
+        pResponse->move(move.index);
+        responses.push_back(pResponse);
+    }
+    generatedStates_ += responses.size();
+    return responses;
+}
+
+void QubicResponseGenerator::generate(QubicState const & state, QubicState::MoveList * pMoves)
+{
+    pMoves->clear();
+    if (state.isDone())
+    {
+        return;
+    }
+
+    BoardCell        xo       = QubicState::toCell(state.whoseTurn());
+    BoardCell        opponent = (xo == BoardCell::X) ? BoardCell::O : BoardCell::X;
+    QubicState::Mask wins     = state.threats(xo);
+    QubicState::Mask blocks   = state.threats(opponent);
+
+    // Forced moves: win if possible, and otherwise block
+    QubicState::Mask candidates = (wins != 0) ? wins : (blocks != 0) ? blocks : state.emptyMask();
+
+    // The moves that keep the most lines alive are searched first. The sort is stable, so ties stay in index order.
+    std::array<int, QubicState::CELLS> keys;
+    for (; candidates != 0; candidates &= candidates - 1)
+    {
+        int index = QubicState::firstIndex(candidates);
+        keys[index] = liveLinesThrough(state, index);
+        pMoves->push_back({ xo, index });
+    }
+    std::stable_sort(pMoves->begin(), pMoves->end(), [&keys] (QubicState::Move const & a, QubicState::Move const & b) {
+        return keys[a.index] > keys[b.index];
+    });
+}
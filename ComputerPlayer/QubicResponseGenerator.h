@@ -0,0 +1,40 @@
+#pragma once
+
+#include "TicTacToeState/QubicState.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace GamePlayer
+{
+class GameState;
+}
+
+// Generates the responses to a Qubic state for GamePlayer::GameTree, to be used with QubicEvaluator.
+//
+// With up to 64 responses to each state, a search of Qubic spends most of its time generating and freeing states, so the
+// responses are allocated from a pool and the moves are ordered so that alpha-beta prunes as much as possible. Forced moves
+// are not searched alongside the moves they make irrelevant: if the player to move can complete a line, only the winning
+// moves are returned, and otherwise if the opponent threatens to complete a line, only the moves that block it are returned,
+// since any other move loses on the next ply.
+class QubicResponseGenerator
+{
+public:
+    // Constructor
+    QubicResponseGenerator();
+
+    // Returns the responses to a state, best first. The caller owns the responses. The depth is not used.
+    std::vector<GamePlayer::GameState *> operator ()(GamePlayer::GameState const & state, int depth);
+
+    // Replaces the contents of the list with the moves that are searched from the state, best first
+    static void generate(QubicState const & state, QubicState::MoveList * pMoves);
+
+    // Returns the number of states generated since the generator was created or resetGeneratedStates() was called
+    uint64_t generatedStates() const { return generatedStates_; }
+
+    // Resets the number of states generated
+    void resetGeneratedStates() { generatedStates_ = 0; }
+
+private:
+    uint64_t generatedStates_; // Number of states generated
+};
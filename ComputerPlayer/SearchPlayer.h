@@ -0,0 +1,90 @@
+#pragma once
+
+#include "HistoryOrdering.h"
+#include "NegamaxSearch.h"
+#include "SharedTranspositionTable.h"
+#include "StopSignal.h"
+
+#include "Components/Player.h"
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+
+// A computer player for a board of any size.
+//
+// ComputerPlayer's engines are built around tables indexed by the 3x3 state, but this player plays any BasicTicTacToeState
+// and DynamicTicTacToeState. It searches with the same NegamaxSearch as ComputerPlayer's NEGAMAX engine, one ply deeper at
+// a time, until the maximum depth is reached, the result can no longer change, or the time runs out. Since the number of
+// states grows too quickly with the size of the board for a table indexed by state, the results are kept in a table keyed
+// by the fingerprint, and the moves are ordered by a HistoryOrdering, which does not depend on the size of the board.
+//
+// The State must provide what NegamaxSearch requires, and fingerprint(), which identifies it in the table. The Evaluator
+// must provide evaluate(State const &), which returns a value that is positive when it favors Alice.
+template <typename State, typename Evaluator>
+class SearchPlayer : public BasicPlayer<State>
+{
+public:
+    using PlayerId = typename State::PlayerId;
+    using Move     = typename State::Move;
+    using Searcher = NegamaxSearch<State, Evaluator, HistoryOrdering<State>, SharedTranspositionTable>;
+
+    // Search options
+    struct Options
+    {
+        // Maximum number of plies searched below the current state, or 0 for the deepest search possible
+        int maxDepth = 0;
+
+        // Time allowed per move, or 0 for no limit
+        std::chrono::milliseconds timeBudget { 1000 };
+
+        // Minimum number of entries in the transposition table
+        size_t tableSize = size_t(1) << 20;
+    };
+
+    // Constructor
+    explicit SearchPlayer(PlayerId playerId, Options const & options = Options())
+        : BasicPlayer<State>(playerId)
+        , options_(options)
+        , evaluator_()
+        , searcher_(evaluator_,
+                    (options.maxDepth > 0) ? options.maxDepth : Searcher::MAX_DEPTH,
+                    std::make_shared<SharedTranspositionTable>(options.tableSize))
+    {
+    }
+
+    // Gets a move from the computer and applies it to the game state. Overrides BasicPlayer::move().
+    virtual void move(State * pState) override
+    {
+        // Let's be safe and check if the state is valid
+        if (pState == nullptr || pState->isDone())
+        {
+            return;
+        }
+
+        stop_.start();
+        typename Searcher::Budget budget;
+        budget.time  = options_.timeBudget;
+        budget.pStop = stop_.flag();
+        Move best    = searcher_.findBestMove(*pState, budget);
+        stop_.finish();
+
+        pState->move(best.row, best.column);
+    }
+
+    // Stops a move in progress on another thread as soon as possible. The best move found so far is still made. Overrides
+    // BasicPlayer::cancel().
+    virtual void cancel() override { stop_.request(); }
+
+    // Returns the depth of the deepest search completed by the last move
+    int completedDepth() const { return searcher_.completedDepth(); }
+
+    // Returns the counts of the work done by all moves
+    typename Searcher::Statistics const & statistics() const { return searcher_.statistics(); }
+
+private:
+    Options    options_;   // Search options
+    Evaluator  evaluator_; // Static evaluator for the leaves
+    Searcher   searcher_;  // Iterative-deepening search, with its table and move ordering
+    StopSignal stop_;      // Stops the current move
+};
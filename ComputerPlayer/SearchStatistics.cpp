@@ -0,0 +1,29 @@
+#include "SearchStatistics.h"
+
+double SearchStatistics::nodesPerSecond() const
+{
+    double seconds = std::chrono::duration<double>(elapsed).count();
+    return (seconds > 0.0) ? double(nodes) / seconds : 0.0;
+}
+
+double SearchStatistics::hitRate() const
+{
+    return (probes > 0) ? double(hits) / double(probes) : 0.0;
+}
+
+SearchStatistics & SearchStatistics::operator +=(SearchStatistics const & rhs)
+{
+    nodes += rhs.nodes;
+    leaves += rhs.leaves;
+    cutoffs += rhs.cutoffs;
+    for (int i = 0; i < MAX_PLY; ++i)
+    {
+        cutoffsByPly[i] += rhs.cutoffsByPly[i];
+    }
+    probes += rhs.probes;
+    hits += rhs.hits;
+    collisions += rhs.collisions;
+    overwrites += rhs.overwrites;
+    elapsed += rhs.elapsed;
+    return *this;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+// Counts of the work done by searches.
+//
+// The counts are plain integers updated by the thread doing the search, so collecting them costs only a few increments per
+// state. Parallel searches keep a set per thread and add them up when asked. Statistics can be added together, so the counts
+// of a single search can be accumulated over many moves and games.
+struct SearchStatistics
+{
+    // Number of plies whose cutoffs are counted separately. Cutoffs at this ply or deeper are counted in the last element.
+    static int constexpr MAX_PLY = 16;
+
+    uint64_t                             nodes        = 0;  // Number of states searched, including the leaves
+    uint64_t                             leaves       = 0;  // Number of states given a static evaluation
+    uint64_t                             cutoffs      = 0;  // Number of states whose remaining moves were pruned
+    std::array<uint64_t, MAX_PLY>        cutoffsByPly = {}; // Cutoffs by distance from the root
+    uint64_t                             probes       = 0;  // Number of transposition table lookups
+    uint64_t                             hits         = 0;  // Lookups that found an entry for the state
+    uint64_t                             collisions   = 0;  // Lookups that found the state's slots taken by other states
+    uint64_t                             overwrites   = 0;  // Stores that replaced the entry of another state
+    std::chrono::steady_clock::duration  elapsed      = {}; // Wall-clock time spent searching, measured by the caller
+
+    // Records a cutoff at the specified ply
+    void cutoff(int ply)
+    {
+        ++cutoffs;
+        ++cutoffsByPly[(ply < MAX_PLY) ? ply : MAX_PLY - 1];
+    }
+
+    // Returns the number of states searched per second, or 0 if no time has elapsed
+    double nodesPerSecond() const;
+
+    // Returns the fraction of lookups that found an entry, or 0 if there were none
+    double hitRate() const;
+
+    // Adds the counts of other statistics to these
+    SearchStatistics & operator +=(SearchStatistics const & rhs);
+};
@@ -0,0 +1,109 @@
+#include "SharedTranspositionTable.h"
+
+#include <cassert>
+#include <cstring>
+
+// Layout of a packed entry
+static int const      VALUE_SHIFT    = 0;  // 32 bits: the bits of the float value
+static int const      DEPTH_SHIFT    = 32; // 8 bits: the depth
+static int const      MOVE_SHIFT     = 40; // 8 bits: the best move
+static int const      BOUND_SHIFT    = 48; // 2 bits: the bound
+static int const      COMPLETE_SHIFT = 50; // 1 bit: the complete flag
+static uint64_t const VALID          = 1ull << 63; // Set in every packed entry, so that 0 means empty
+
+SharedTranspositionTable::SharedTranspositionTable(size_t size)
+    : numberOfBuckets_(1)
+{
+    while (numberOfBuckets_ * SLOTS_PER_BUCKET < size)
+    {
+        numberOfBuckets_ *= 2;
+    }
+    buckets_ = std::make_unique<Bucket[]>(numberOfBuckets_);
+    clear();
+}
+
+bool SharedTranspositionTable::probe(uint64_t hash, Entry * pEntry, bool * pCollision) const
+{
+    bool full = true;
+    for (Slot const & slot : bucket(hash).slots)
+    {
+        uint64_t data = slot.data.load(std::memory_order_relaxed);
+        if (data != 0 && (slot.check.load(std::memory_order_relaxed) ^ data) == hash)
+        {
+            *pEntry = unpack(data);
+            if (pCollision)
+                *pCollision = false;
+            return true;
+        }
+        full = full && data != 0;
+    }
+    if (pCollision)
+        *pCollision = full;
+    return false;
+}
+
+bool SharedTranspositionTable::store(uint64_t hash, Entry const & entry)
+{
+    // Use the slot that already has this state, or else an empty slot, or else the slot with the shallowest search
+    Slot * pVictim     = nullptr;
+    int    victimDepth = INT8_MAX + 1;
+    bool   overwrite   = true;
+    for (Slot & slot : bucket(hash).slots)
+    {
+        uint64_t data = slot.data.load(std::memory_order_relaxed);
+        if (data == 0 || (slot.check.load(std::memory_order_relaxed) ^ data) == hash)
+        {
+            pVictim   = &slot;
+            overwrite = false;
+            break;
+        }
+        int depth = unpack(data).depth;
+        if (depth < victimDepth)
+        {
+            pVictim     = &slot;
+            victimDepth = depth;
+        }
+    }
+    assert(pVictim);
+
+    uint64_t data = pack(entry);
+    pVictim->check.store(hash ^ data, std::memory_order_relaxed);
+    pVictim->data.store(data, std::memory_order_relaxed);
+    return overwrite;
+}
+
+void SharedTranspositionTable::clear()
+{
+    for (size_t i = 0; i < numberOfBuckets_; ++i)
+    {
+        for (Slot & slot : buckets_[i].slots)
+        {
+            slot.check.store(0, std::memory_order_relaxed);
+            slot.data.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+uint64_t SharedTranspositionTable::pack(Entry const & entry)
+{
+    uint32_t value;
+    std::memcpy(&value, &entry.value, sizeof(value));
+    return VALID
+         | (uint64_t(value) << VALUE_SHIFT)
+         | (uint64_t(uint8_t(entry.depth)) << DEPTH_SHIFT)
+         | (uint64_t(uint8_t(entry.bestMove)) << MOVE_SHIFT)
+         | (uint64_t(entry.bound) << BOUND_SHIFT)
+         | (uint64_t(entry.complete) << COMPLETE_SHIFT);
+}
+
+SharedTranspositionTable::Entry SharedTranspositionTable::unpack(uint64_t data)
+{
+    Entry    entry;
+    uint32_t value = uint32_t(data >> VALUE_SHIFT);
+    std::memcpy(&entry.value, &value, sizeof(value));
+    entry.depth    = int8_t(uint8_t(data >> DEPTH_SHIFT));
+    entry.bestMove = int8_t(uint8_t(data >> MOVE_SHIFT));
+    entry.bound    = Bound((data >> BOUND_SHIFT) & 3);
+    entry.complete = ((data >> COMPLETE_SHIFT) & 1) != 0;
+    return entry;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "FlatTranspositionTable.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+// A transposition table that can be probed and stored into by many threads at once without locks.
+//
+// The table is an array of buckets, each the size of a cache line, and each bucket holds a few slots. A state's 64-bit hash
+// selects a bucket, and its entry can be in any slot of the bucket. An entry is packed into 64 bits, and a slot stores it
+// along with the hash XORed with it. Two threads storing into the same slot at once can leave a slot whose halves do not
+// match, but then the XOR does not give back the hash, so the slot is treated as empty instead of returning a corrupt entry.
+class SharedTranspositionTable
+{
+public:
+    using Entry = FlatTranspositionTable::Entry;
+    using Bound = FlatTranspositionTable::Bound;
+
+    // Number of slots in a bucket
+    static int constexpr SLOTS_PER_BUCKET = 4;
+
+    // Constructor. The size is the minimum number of entries. It is rounded up to a power of 2 number of buckets.
+    explicit SharedTranspositionTable(size_t size);
+
+    SharedTranspositionTable(SharedTranspositionTable const &)              = delete;
+    SharedTranspositionTable & operator =(SharedTranspositionTable const &) = delete;
+
+    // Gets the entry for the state with the specified hash. Returns false if there is none. If pCollision is not null, it is
+    // set to true if there is no entry because every slot in the bucket holds the entry of another state.
+    bool probe(uint64_t hash, Entry * pEntry, bool * pCollision = nullptr) const;
+
+    // Stores the entry for the state with the specified hash. If the bucket is full, the entry with the shallowest search is
+    // replaced. Returns true if the entry of another state was replaced.
+    bool store(uint64_t hash, Entry const & entry);
+
+    // Gets the entry for a state, which is identified by its fingerprint(). Returns false if there is none.
+    template <typename State, typename = std::enable_if_t<!std::is_integral_v<State>>>
+    bool probe(State const & state, Entry * pEntry, bool * pCollision = nullptr) const
+    {
+        return probe(static_cast<uint64_t>(state.fingerprint()), pEntry, pCollision);
+    }
+
+    // Stores the entry for a state, which is identified by its fingerprint(). Returns true if the entry of another state was
+    // replaced.
+    template <typename State, typename = std::enable_if_t<!std::is_integral_v<State>>>
+    bool store(State const & state, Entry const & entry)
+    {
+        return store(static_cast<uint64_t>(state.fingerprint()), entry);
+    }
+
+    // Removes all entries. This must not be called while other threads are using the table.
+    void clear();
+
+    // Returns the number of entries the table can hold
+    size_t size() const { return numberOfBuckets_ * SLOTS_PER_BUCKET; }
+
+private:
+    struct Slot
+    {
+        std::atomic<uint64_t> check; // The hash XORed with the data
+        std::atomic<uint64_t> data;  // The packed entry, or 0 if the slot is empty
+    };
+
+    struct alignas(64) Bucket
+    {
+        Slot slots[SLOTS_PER_BUCKET];
+    };
+
+    static_assert(sizeof(Bucket) == 64, "A bucket should fill a cache line");
+
+    // Packs an entry into 64 bits. A packed entry is never 0.
+    static uint64_t pack(Entry const & entry);
+
+    // Unpacks an entry
+    static Entry unpack(uint64_t data);
+
+    Bucket & bucket(uint64_t hash) const { return buckets_[hash & (numberOfBuckets_ - 1)]; }
+
+    size_t                    numberOfBuckets_; // Number of buckets, which is a power of 2
+    std::unique_ptr<Bucket[]> buckets_;         // The buckets
+};
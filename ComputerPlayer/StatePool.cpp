@@ -0,0 +1,60 @@
+#include "StatePool.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+
+StatePool::StatePool(size_t slotSize, size_t slotsPerChunk)
+    : slotSize_(0)
+    , slotsPerChunk_(slotsPerChunk)
+    , slotsInUse_(0)
+    , free_(nullptr)
+{
+    assert(slotsPerChunk > 0);
+
+    // Round the size up so that every slot is suitably aligned and can hold a free-list link
+    size_t const alignment = alignof(std::max_align_t);
+    slotSize_ = (std::max(slotSize, sizeof(FreeSlot)) + alignment - 1) / alignment * alignment;
+}
+
+void * StatePool::allocate()
+{
+    if (free_ == nullptr)
+    {
+        grow();
+    }
+
+    FreeSlot * slot = free_;
+    free_ = slot->next;
+    ++slotsInUse_;
+    return slot;
+}
+
+void StatePool::deallocate(void * p)
+{
+    if (p == nullptr)
+    {
+        return;
+    }
+
+    assert(slotsInUse_ > 0);
+    FreeSlot * slot = static_cast<FreeSlot *>(p);
+    slot->next = free_;
+    free_      = slot;
+    --slotsInUse_;
+}
+
+void StatePool::grow()
+{
+    // new[] returns memory aligned for any type, so every slot is aligned as well
+    chunks_.emplace_back(new std::byte[slotSize_ * slotsPerChunk_]);
+    std::byte * chunk = chunks_.back().get();
+
+    // Link the slots in order so that consecutive allocations are adjacent in memory
+    for (size_t i = slotsPerChunk_; i > 0; --i)
+    {
+        FreeSlot * slot = reinterpret_cast<FreeSlot *>(chunk + (i - 1) * slotSize_);
+        slot->next = free_;
+        free_      = slot;
+    }
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// A pool of fixed-size memory slots for the states in a game tree.
+//
+// Slots are carved out of large chunks and recycled through a free list, so allocating and freeing a state is a couple of
+// pointer operations and never touches the global allocator once the pool has grown to the size of the search. The chunks
+// are kept until the pool is destroyed. A pool is not thread-safe; each thread should use its own pool.
+class StatePool
+{
+public:
+    // Constructor
+    explicit StatePool(size_t slotSize, size_t slotsPerChunk = 1024);
+
+    // Destructor. All slots must have been returned.
+    ~StatePool() = default;
+
+    StatePool(StatePool const &)              = delete;
+    StatePool & operator =(StatePool const &) = delete;
+
+    // Returns a slot of at least the slot size, aligned for any type
+    void * allocate();
+
+    // Returns a slot to the pool
+    void deallocate(void * p);
+
+    // Returns the size of a slot
+    size_t slotSize() const { return slotSize_; }
+
+    // Returns the number of slots that are allocated and not yet returned
+    size_t slotsInUse() const { return slotsInUse_; }
+
+    // Returns the total number of slots in the pool
+    size_t capacity() const { return chunks_.size() * slotsPerChunk_; }
+
+private:
+
+    struct FreeSlot
+    {
+        FreeSlot * next;
+    };
+
+    size_t                                    slotSize_;      // Size of a slot, rounded up to the maximum alignment
+    size_t                                    slotsPerChunk_; // Number of slots added to the pool when it is empty
+    size_t                                    slotsInUse_;    // Number of slots allocated and not yet returned
+    FreeSlot *                                free_;          // List of the available slots
+    std::vector<std::unique_ptr<std::byte[]>> chunks_;        // The memory for the slots
+
+    void grow(); // Add a chunk of slots to the free list
+};
+
+// A State allocated from a per-thread pool instead of the global heap.
+//
+// GameTree takes ownership of the responses and deletes them through GameState pointers. The virtual destructor ensures
+// that the class-specific operator delete is used, so the slots return to the pool. Since the pool belongs to a thread, a
+// state must be deleted on the thread that allocated it, which is the case for a search within findBestResponse(). A pool
+// lasts as long as its thread, so the moves should be found on a thread that is reused (see Worker).
+template <typename State>
+class Pooled : public State
+{
+public:
+    explicit Pooled(State const & state)
+        : State(state)
+    {
+    }
+
+    static void * operator new([[maybe_unused]] size_t size)
+    {
+        assert(size <= pool().slotSize());
+        return pool().allocate();
+    }
+
+    static void operator delete(void * p) { pool().deallocate(p); }
+
+private:
+    static StatePool & pool()
+    {
+        static thread_local StatePool pool_(sizeof(Pooled));
+        return pool_;
+    }
+};
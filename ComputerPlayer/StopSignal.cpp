@@ -0,0 +1,27 @@
+#include "StopSignal.h"
+
+StopSignal::StopSignal()
+    : working_(false)
+    , stop_(false)
+{
+}
+
+void StopSignal::start()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    working_ = true;
+}
+
+void StopSignal::finish()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    working_ = false;
+    stop_    = false;
+}
+
+void StopSignal::request()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (working_)
+        stop_ = true;
+}
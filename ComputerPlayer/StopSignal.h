@@ -0,0 +1,36 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+// Asks a player's move or pondering, running on another thread, to stop.
+//
+// The player marks the start and end of its work, and a request only has an effect while the work is in progress, so a
+// request made between moves does not stop the next one. The searches poll the flag, which is cleared when the work is done.
+class StopSignal
+{
+public:
+    // Constructor
+    StopSignal();
+
+    StopSignal(StopSignal const &)              = delete;
+    StopSignal & operator =(StopSignal const &) = delete;
+
+    // Marks the start and end of the work, which is when request() has an effect
+    void start();
+    void finish();
+
+    // Asks the work in progress to stop. If there is none, the request is ignored.
+    void request();
+
+    // Returns true if the work in progress has been asked to stop
+    bool requested() const { return stop_.load(std::memory_order_relaxed); }
+
+    // Returns the flag polled by the searches, which becomes true when the work is asked to stop
+    std::atomic<bool> const * flag() const { return &stop_; }
+
+private:
+    std::mutex        mutex_;   // Guards working_ and the setting of stop_
+    bool              working_; // True while the work is in progress
+    std::atomic<bool> stop_;    // If true, the work in progress is stopped
+};
@@ -0,0 +1,72 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <cassert>
+
+ThreadPool::ThreadPool(int numberOfThreads)
+    : pTask_(nullptr)
+    , generation_(0)
+    , running_(0)
+    , stopping_(false)
+{
+    if (numberOfThreads <= 0)
+    {
+        numberOfThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+
+    threads_.reserve(numberOfThreads);
+    for (int i = 0; i < numberOfThreads; ++i)
+    {
+        threads_.emplace_back(&ThreadPool::work, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    start_.notify_all();
+    for (std::thread & thread : threads_)
+    {
+        thread.join();
+    }
+}
+
+void ThreadPool::run(std::function<void(int)> const & task)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    assert(running_ == 0);
+    pTask_   = &task;
+    running_ = size();
+    ++generation_;
+    start_.notify_all();
+    done_.wait(lock, [this] { return running_ == 0; });
+    pTask_ = nullptr;
+}
+
+void ThreadPool::work(int index)
+{
+    uint64_t generation = 0;
+    for (;;)
+    {
+        std::function<void(int)> const * pTask;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            start_.wait(lock, [this, generation] { return stopping_ || generation_ != generation; });
+            if (stopping_)
+                return;
+            generation = generation_;
+            pTask      = pTask_;
+        }
+
+        (*pTask)(index);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--running_ == 0)
+                done_.notify_all();
+        }
+    }
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A fixed set of worker threads that run a task together.
+//
+// The threads are started once and reused, so a parallel search does not pay for creating threads on every move. A task is
+// given to every thread at once and run() waits until they have all finished it. The threads usually share the work by
+// claiming items from an atomic counter.
+class ThreadPool
+{
+public:
+    // Constructor. If the number of threads is 0, the number of hardware threads is used.
+    explicit ThreadPool(int numberOfThreads = 0);
+
+    // Destructor. Waits for the threads to exit.
+    ~ThreadPool();
+
+    ThreadPool(ThreadPool const &)              = delete;
+    ThreadPool & operator =(ThreadPool const &) = delete;
+
+    // Runs the task on every thread and returns when all of them are done. The task is given the index of the thread, in
+    // the range [0, size()). It must not throw.
+    void run(std::function<void(int)> const & task);
+
+    // Returns the number of threads
+    int size() const { return static_cast<int>(threads_.size()); }
+
+private:
+    void work(int index); // The loop run by each thread
+
+    std::vector<std::thread>         threads_;    // The worker threads
+    std::mutex                       mutex_;      // Guards the members below
+    std::condition_variable          start_;      // Signaled when there is a new task or the pool is shutting down
+    std::condition_variable          done_;       // Signaled when the last thread finishes a task
+    std::function<void(int)> const * pTask_;      // The current task
+    uint64_t                         generation_; // Incremented for each task, so a thread runs each task only once
+    int                              running_;    // Number of threads that have not yet finished the current task
+    bool                             stopping_;   // True if the threads should exit
+};
@@ -1,35 +1,147 @@
 #pragma once
 
-#include "GamePlayer/StaticEvaluator.h"
+#include "TicTacToeHeuristic.h"
+
+#include "Components/Board.h"
+#include "TicTacToeState/TicTacToeState.h"
+
+#include <array>
+#include <cassert>
+#include <cstdint>
 
 namespace GamePlayer
 {
 class GameState;
 }
 
-// A static evaluation function for tic-tac-toe.
-class TicTacToeEvaluator : public GamePlayer::StaticEvaluator
+// A static evaluation function for tic-tac-toe, on a board with Rows rows and Columns columns on which K marks in a line win.
+//
+// The value of a state depends only on its board, so in TABLE mode the value of every board is computed once, by the
+// heuristic, and stored in a table indexed by the board's rank. Evaluation is then a single load. The table is only
+// available for boards of up to 12 cells; bigger boards are always evaluated by the heuristic. The 3x3 evaluator is
+// TicTacToeEvaluator.
+template <int Rows, int Columns, int K>
+class BasicTicTacToeEvaluator : public TicTacToeHeuristic
 {
 public:
-    // Constructor.
-    TicTacToeEvaluator() = default;
+    using State = BasicTicTacToeState<Rows, Columns, K>;
+    using Board = typename State::Board;
+    using Mask  = typename Board::Mask;
+
+    // True if TABLE mode is available
+    static bool constexpr HAS_TABLE = Board::HAS_RANKS && Board::CELLS <= 12;
+
+    // How states are evaluated
+    enum class Mode
+    {
+        HEURISTIC, // Compute the heuristic for each state
+        TABLE      // Look up the value in a table of precomputed values
+    };
+
+    // Constructor. If the board has no table, the mode is always HEURISTIC.
+    explicit BasicTicTacToeEvaluator(Mode mode = Mode::TABLE);
 
     // Destructor.
-    virtual ~TicTacToeEvaluator() = default;
+    virtual ~BasicTicTacToeEvaluator() = default;
 
     // Returns a value for the given tic-tac-toe state. Overrides StaticEvaluator::evaluate().
     virtual float evaluate(GamePlayer::GameState const & state) const override;
 
-    // Returns the value of a winning state for Alice. Overrides StaticEvaluator::aliceWinsValue().
-    virtual float aliceWinsValue() const override { return WIN_VALUE; }
+    // Returns a value for the given tic-tac-toe state. This is not virtual, so a search that knows the type of its evaluator
+    // can call it directly.
+    float evaluate(State const & state) const
+    {
+        if constexpr (HAS_TABLE)
+            return (mode_ == Mode::TABLE) ? static_cast<float>((*pTable_)[state.rank()]) : heuristic(state);
+        else
+            return heuristic(state);
+    }
 
-    // Returns the value of a winning state for Bob. Overrides StaticEvaluator::bobWinsValue().
-    virtual float bobWinsValue() const override { return -WIN_VALUE; }
+    // Returns the evaluation mode
+    Mode mode() const { return mode_; }
 
 private:
-    // Value constants for evaluation
-    static float constexpr WIN_VALUE         = 10000.0f;
-    static float constexpr CENTER_BONUS      = 5.0f;
-    static float constexpr CORNER_BONUS      = 1.0f;
-    static float constexpr TWO_IN_LINE_BONUS = 100.0f;
+    using ValueTable = std::array<int16_t, HAS_TABLE ? Board::NUMBER_OF_RANKS : 1>; // Values of every board, indexed by rank
+
+    Mode               mode_;   // Evaluation mode
+    ValueTable const * pTable_; // Table of values (TABLE mode only)
+
+    // Returns the value of a state computed by the heuristic. This is the reference used to fill the table.
+    static float heuristic(State const & state);
+
+    // Returns the table of values, computing it the first time it is needed
+    static ValueTable const & table();
+
+    // Mask of the center cell, or of the 2 or 4 center cells of a board with an even number of rows or columns
+    static Mask constexpr CENTER = [] () {
+            Mask center = 0;
+            for (int r = (Rows - 1) / 2; r <= Rows / 2; ++r)
+            {
+                for (int c = (Columns - 1) / 2; c <= Columns / 2; ++c)
+                {
+                    center |= Mask(Mask(1) << (r * Columns + c));
+                }
+            }
+            return center;
+        }();
+
+    // Mask of the corner cells
+    static Mask constexpr CORNERS = Mask((Mask(1) << 0) | (Mask(1) << (Columns - 1)) | (Mask(1) << ((Rows - 1) * Columns)) |
+                                         (Mask(1) << (Rows * Columns - 1)));
+
+    // The values are integers, and the table stores them exactly
+    static_assert(WIN_VALUE <= INT16_MAX, "Values must fit in the table");
 };
+
+// The 3x3 evaluator
+using TicTacToeEvaluator = BasicTicTacToeEvaluator<3, 3, 3>;
+
+template <int Rows, int Columns, int K>
+BasicTicTacToeEvaluator<Rows, Columns, K>::BasicTicTacToeEvaluator(Mode mode)
+    : mode_(HAS_TABLE ? mode : Mode::HEURISTIC)
+    , pTable_(nullptr)
+{
+    if constexpr (HAS_TABLE)
+    {
+        if (mode_ == Mode::TABLE)
+            pTable_ = &table();
+    }
+}
+
+template <int Rows, int Columns, int K>
+float BasicTicTacToeEvaluator<Rows, Columns, K>::evaluate(GamePlayer::GameState const & state) const
+{
+    // Check if the state is a tic-tac-toe state of this size
+    assert(dynamic_cast<State const *>(&state) != nullptr);
+    return evaluate(static_cast<State const &>(state));
+}
+
+template <int Rows, int Columns, int K>
+float BasicTicTacToeEvaluator<Rows, Columns, K>::heuristic(State const & tttState)
+{
+    Board const & board = tttState.board();
+    Mask          xs    = board.mask(BoardCell::X);
+    Mask          os    = board.mask(BoardCell::O);
+    return value(tttState,
+                 Board::count(xs & CENTER) - Board::count(os & CENTER),
+                 Board::count(xs & CORNERS) - Board::count(os & CORNERS));
+}
+
+template <int Rows, int Columns, int K>
+auto BasicTicTacToeEvaluator<Rows, Columns, K>::table() -> ValueTable const &
+{
+    // The value of a state depends only on its board, so the player to move is arbitrary. Boards that cannot be reached in
+    // a game are included to keep the indexing simple; their values are never used.
+    static ValueTable const values = [] () {
+            ValueTable t;
+            for (typename Board::Rank rank = 0; rank < Board::NUMBER_OF_RANKS; ++rank)
+            {
+                t[rank] = static_cast<int16_t>(heuristic(State(Board::unrank(rank), State::PlayerId::ALICE)));
+            }
+            return t;
+        }();
+    return values;
+}
+
+// The 3x3 evaluator is compiled once, in TicTacToeEvaluator.cpp
+extern template class BasicTicTacToeEvaluator<3, 3, 3>;
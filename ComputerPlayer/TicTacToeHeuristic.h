@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Components/Board.h"
+#include "GamePlayer/StaticEvaluator.h"
+
+// The heuristic of the tic-tac-toe evaluators, which is the same for every board.
+//
+// A state that X has won is worth WIN_VALUE, one that O has won is worth -WIN_VALUE, and a draw is worth 0. Otherwise, X
+// gains and O loses points for each line that is one mark short of a win with the rest empty, and for each center and
+// corner cell. Each evaluator finds the center and corner cells of its own board, and the value is computed here.
+class TicTacToeHeuristic : public GamePlayer::StaticEvaluator
+{
+public:
+    // Destructor.
+    virtual ~TicTacToeHeuristic() = default;
+
+    // Returns the value of a winning state for Alice. Overrides StaticEvaluator::aliceWinsValue().
+    virtual float aliceWinsValue() const override { return WIN_VALUE; }
+
+    // Returns the value of a winning state for Bob. Overrides StaticEvaluator::bobWinsValue().
+    virtual float bobWinsValue() const override { return -WIN_VALUE; }
+
+protected:
+    // Value constants for evaluation
+    static float constexpr WIN_VALUE         = 10000.0f;
+    static float constexpr CENTER_BONUS      = 5.0f;
+    static float constexpr CORNER_BONUS      = 1.0f;
+    static float constexpr TWO_IN_LINE_BONUS = 100.0f;
+
+    // Returns the value of a state, given the number of center cells and the number of corner cells with an X minus the
+    // number with an O
+    template <typename State>
+    static float value(State const & tttState, int centers, int corners)
+    {
+        // If there are K Xs or K Os in a row, return the corresponding win value
+        if (tttState.winner() == BoardCell::X)
+        {
+            return WIN_VALUE;
+        }
+        if (tttState.winner() == BoardCell::O)
+        {
+            return -WIN_VALUE;
+        }
+
+        // If the game is a draw, return 0
+        if (tttState.isDraw())
+        {
+            return 0.0f;
+        }
+
+        // Evaluate the score based on the current board state
+
+        float score = 0.0f;
+
+        // Count the rows, columns, and diagonals that are one X or O short of a win, with the rest empty
+        score += TWO_IN_LINE_BONUS * (tttState.twoInLineCount(BoardCell::X) - tttState.twoInLineCount(BoardCell::O));
+
+        // Add the center and corner bonuses
+        score += CENTER_BONUS * centers;
+        score += CORNER_BONUS * corners;
+
+        return score;
+    }
+};
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// A single worker thread that runs tasks one at a time, in the order they are submitted.
+//
+// Unlike std::async, which may start a new thread for every call, the thread is started once and reused. Anything kept per
+// thread, such as the StatePool of the states in a game tree, therefore lasts from one move to the next.
+class Worker
+{
+public:
+    // Constructor
+    Worker();
+
+    // Destructor. Finishes the tasks that have been submitted and waits for the thread to exit.
+    ~Worker();
+
+    Worker(Worker const &)              = delete;
+    Worker & operator =(Worker const &) = delete;
+
+    // Queues a function to run on the worker thread and returns the future of its result
+    template <typename Function>
+    auto submit(Function function) -> std::future<decltype(function())>
+    {
+        using Result = decltype(function());
+        auto                pTask  = std::make_shared<std::packaged_task<Result()>>(std::move(function));
+        std::future<Result> result = pTask->get_future();
+        post([pTask] { (*pTask)(); });
+        return result;
+    }
+
+private:
+    void post(std::function<void()> task); // Adds a task to the queue
+    void work();                           // The loop run by the thread
+
+    std::mutex                        mutex_;    // Guards the members below
+    std::condition_variable           ready_;    // Signaled when there is a new task or the worker is shutting down
+    std::deque<std::function<void()>> tasks_;    // Tasks waiting to be run
+    bool                              stopping_; // True if the thread should exit once the queue is empty
+    std::thread                       thread_;   // The worker thread, started after the members above
+};
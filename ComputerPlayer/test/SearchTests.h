@@ -0,0 +1,72 @@
+#pragma once
+
+#include "gtest/gtest.h"
+
+#include "Components/Board.h"
+#include "ComputerPlayer/MoveOrdering.h"
+#include "ComputerPlayer/NegamaxSearch.h"
+#include "ComputerPlayer/TicTacToeEvaluator.h"
+#include "TicTacToeState/TicTacToeState.h"
+
+// Helpers shared by the tests of the searches
+
+namespace TicTacToe
+{
+using Searcher = NegamaxSearch<TicTacToeState, TicTacToeEvaluator, MoveOrdering>;
+
+// Leaves the moves in index order. Unlike MoveOrdering, it can be used with a board of any size.
+struct IndexOrdering
+{
+    template <typename State>
+    void order(State const &, typename State::MoveList *, int, int) const
+    {
+    }
+
+    template <typename State>
+    void cutoff(State const &, typename State::Move const &, int, int)
+    {
+    }
+
+    void clear() {}
+};
+
+// A 3x4 game with 3 in a line, used to check that the searches are not tied to the 3x3 board
+using State3x4     = BasicTicTacToeState<3, 4, 3>;
+using Evaluator3x4 = BasicTicTacToeEvaluator<3, 4, 3>;
+
+// Returns a 3x4 state in which X, to move, wins only by completing the last column at the bottom right
+inline State3x4 LastColumnWin()
+{
+    State3x4 state;
+    state.move(0, 3); // X
+    state.move(0, 0); // O
+    state.move(1, 3); // X
+    state.move(2, 0); // O threatens to complete the first column
+    return state;
+}
+
+// Returns the index of the cell of a move
+inline int IndexOf(TicTacToeState::Move const & move)
+{
+    return Board::toIndex(move.row, move.column);
+}
+
+// Checks that a search agrees with a serial search for every state reachable from the given state
+template <typename Search>
+void CompareWithSerial(Search & search, Searcher & serial, TicTacToeState & state)
+{
+    if (state.isDone())
+        return;
+
+    ASSERT_EQ(IndexOf(search.findBestMove(state)), IndexOf(serial.findBestMove(state, Searcher::Budget())));
+
+    TicTacToeState::MoveList moves;
+    state.generateMoves(&moves);
+    for (auto const & move : moves)
+    {
+        state.move(move.row, move.column);
+        CompareWithSerial(search, serial, state);
+        state.unmove();
+    }
+}
+} // namespace TicTacToe
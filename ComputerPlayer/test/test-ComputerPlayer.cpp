@@ -5,7 +5,9 @@
 #include "TicTacToeState/TicTacToeState.h"
 
 #include <algorithm>
+#include <atomic>
 #include <numeric>
+#include <thread>
 
 namespace TicTacToe
 {
@@ -58,4 +60,290 @@ TEST(ComputerPlayer, Move)
         ASSERT_TRUE((*i2 == Board::Cell::NEITHER) && (*i3 == Board::Cell::O));
     }
 }
+
+TEST(ComputerPlayer, Move_canonicalFingerprints)
+{
+    ComputerPlayer::Options options;
+    options.canonicalFingerprints = true;
+
+    // X can win by completing the top row
+    Board board({{
+                    Board::Cell::X,       Board::Cell::X,       Board::Cell::NEITHER,
+                    Board::Cell::O,       Board::Cell::O,       Board::Cell::NEITHER,
+                    Board::Cell::NEITHER, Board::Cell::NEITHER, Board::Cell::NEITHER
+                }});
+    TicTacToeState state(board, TicTacToeState::PlayerId::ALICE);
+    ComputerPlayer computerX(TicTacToeState::PlayerId::ALICE, options);
+    computerX.move(&state);
+    EXPECT_EQ(state.winner(), Board::Cell::X);
+    EXPECT_EQ(state.board().at(0, 2), Board::Cell::X);
+
+    // The setting does not leak into the game state
+    EXPECT_FALSE(state.usesCanonicalFingerprint());
+}
+
+TEST(ComputerPlayer, Move_negamax)
+{
+    ComputerPlayer::Options gameTreeOptions;
+    ComputerPlayer::Options negamaxOptions;
+    negamaxOptions.engine = ComputerPlayer::Options::Engine::NEGAMAX;
+
+    // Both engines play the same game against themselves
+    TicTacToeState gameTreeState;
+    TicTacToeState negamaxState;
+    ComputerPlayer gameTreeX(TicTacToeState::PlayerId::ALICE, gameTreeOptions);
+    ComputerPlayer gameTreeO(TicTacToeState::PlayerId::BOB, gameTreeOptions);
+    ComputerPlayer negamaxX(TicTacToeState::PlayerId::ALICE, negamaxOptions);
+    ComputerPlayer negamaxO(TicTacToeState::PlayerId::BOB, negamaxOptions);
+    while (!gameTreeState.isDone())
+    {
+        bool xToMove = gameTreeState.whoseTurn() == TicTacToeState::PlayerId::ALICE;
+        (xToMove ? gameTreeX : gameTreeO).move(&gameTreeState);
+        (xToMove ? negamaxX : negamaxO).move(&negamaxState);
+        ASSERT_EQ(negamaxState.board().value(), gameTreeState.board().value());
+    }
+    EXPECT_TRUE(negamaxState.isDone());
+    EXPECT_TRUE(negamaxState.isDraw());
+
+    // O blocks X
+    Board board({{
+                    Board::Cell::X,       Board::Cell::NEITHER, Board::Cell::NEITHER,
+                    Board::Cell::NEITHER, Board::Cell::X,       Board::Cell::NEITHER,
+                    Board::Cell::O,       Board::Cell::NEITHER, Board::Cell::NEITHER
+                }});
+    TicTacToeState state(board, TicTacToeState::PlayerId::BOB);
+    negamaxO.move(&state);
+    EXPECT_EQ(state.board().at(2, 2), Board::Cell::O);
+}
+
+TEST(ComputerPlayer, Move_budget)
+{
+    // Even with almost no budget, the computer makes a move
+    ComputerPlayer::Options options;
+    options.engine     = ComputerPlayer::Options::Engine::NEGAMAX;
+    options.nodeBudget = 1;
+
+    TicTacToeState state;
+    ComputerPlayer computerX(TicTacToeState::PlayerId::ALICE, options);
+    computerX.move(&state);
+    EXPECT_EQ(state.numberOfMoves(), 1);
+    EXPECT_EQ(state.whoseTurn(), TicTacToeState::PlayerId::BOB);
+
+    // A smaller maximum depth still finds an immediate win
+    options.nodeBudget = 0;
+    options.maxDepth   = 1;
+    Board board({{
+                    Board::Cell::X,       Board::Cell::X,       Board::Cell::NEITHER,
+                    Board::Cell::O,       Board::Cell::O,       Board::Cell::NEITHER,
+                    Board::Cell::NEITHER, Board::Cell::NEITHER, Board::Cell::NEITHER
+                }});
+    TicTacToeState winnable(board, TicTacToeState::PlayerId::ALICE);
+    ComputerPlayer shallowX(TicTacToeState::PlayerId::ALICE, options);
+    shallowX.move(&winnable);
+    EXPECT_EQ(winnable.winner(), Board::Cell::X);
+}
+
+TEST(ComputerPlayer, Move_parallel)
+{
+    ComputerPlayer::Options serialOptions;
+    ComputerPlayer::Options parallelOptions;
+    serialOptions.engine    = ComputerPlayer::Options::Engine::NEGAMAX;
+    parallelOptions.engine  = ComputerPlayer::Options::Engine::NEGAMAX;
+    parallelOptions.threads = 4;
+
+    for (auto parallelism : { ComputerPlayer::Options::Parallelism::ROOT_SPLIT, ComputerPlayer::Options::Parallelism::LAZY_SMP })
+    {
+        parallelOptions.parallelism = parallelism;
+
+        // The parallel and serial searches play the same game against themselves
+        TicTacToeState serialState;
+        TicTacToeState parallelState;
+        ComputerPlayer serialX(TicTacToeState::PlayerId::ALICE, serialOptions);
+        ComputerPlayer serialO(TicTacToeState::PlayerId::BOB, serialOptions);
+        ComputerPlayer parallelX(TicTacToeState::PlayerId::ALICE, parallelOptions);
+        ComputerPlayer parallelO(TicTacToeState::PlayerId::BOB, parallelOptions);
+        while (!serialState.isDone())
+        {
+            bool xToMove = serialState.whoseTurn() == TicTacToeState::PlayerId::ALICE;
+            (xToMove ? serialX : serialO).move(&serialState);
+            (xToMove ? parallelX : parallelO).move(&parallelState);
+            ASSERT_EQ(parallelState.board().value(), serialState.board().value());
+        }
+        EXPECT_TRUE(parallelState.isDraw());
+    }
+}
+
+TEST(ComputerPlayer, Statistics)
+{
+    ComputerPlayer::Options negamaxOptions;
+    negamaxOptions.engine = ComputerPlayer::Options::Engine::NEGAMAX;
+
+    for (ComputerPlayer::Options const & options : { ComputerPlayer::Options(), negamaxOptions })
+    {
+        ComputerPlayer computerX(TicTacToeState::PlayerId::ALICE, options);
+        EXPECT_EQ(computerX.lastStatistics().nodes, 0u);
+        EXPECT_EQ(computerX.totalStatistics().nodes, 0u);
+
+        // The statistics of each move are added to the totals
+        TicTacToeState state;
+        computerX.move(&state);
+        SearchStatistics first = computerX.lastStatistics();
+        EXPECT_GT(first.nodes, 0u);
+        EXPECT_GT(first.elapsed.count(), 0);
+        EXPECT_GT(first.nodesPerSecond(), 0.0);
+        EXPECT_EQ(computerX.totalStatistics().nodes, first.nodes);
+
+        TicTacToeState::MoveList replies;
+        state.generateMoves(&replies);
+        state.move(replies[0].row, replies[0].column);
+        computerX.move(&state);
+        SearchStatistics second = computerX.lastStatistics();
+        EXPECT_GT(second.nodes, 0u);
+        EXPECT_LT(second.nodes, first.nodes);
+        EXPECT_EQ(computerX.totalStatistics().nodes, first.nodes + second.nodes);
+        EXPECT_EQ(computerX.totalStatistics().elapsed, first.elapsed + second.elapsed);
+
+        computerX.resetStatistics();
+        EXPECT_EQ(computerX.totalStatistics().nodes, 0u);
+        EXPECT_EQ(computerX.lastStatistics().nodes, second.nodes);
+    }
+
+    // The parallel searches add up the work of all of their threads
+    negamaxOptions.threads = 4;
+    for (auto parallelism : { ComputerPlayer::Options::Parallelism::ROOT_SPLIT, ComputerPlayer::Options::Parallelism::LAZY_SMP })
+    {
+        negamaxOptions.parallelism = parallelism;
+        ComputerPlayer computerX(TicTacToeState::PlayerId::ALICE, negamaxOptions);
+        TicTacToeState state;
+        computerX.move(&state);
+        EXPECT_GT(computerX.lastStatistics().nodes, 0u);
+        EXPECT_GT(computerX.lastStatistics().leaves, 0u);
+        EXPECT_GT(computerX.lastStatistics().probes, 0u);
+        EXPECT_GT(computerX.lastStatistics().cutoffs, 0u);
+    }
+}
+
+TEST(ComputerPlayer, Ponder)
+{
+    ComputerPlayer::Options negamaxOptions;
+    negamaxOptions.engine = ComputerPlayer::Options::Engine::NEGAMAX;
+
+    for (ComputerPlayer::Options const & options : { ComputerPlayer::Options(), negamaxOptions })
+    {
+        ComputerPlayer ponderingO(TicTacToeState::PlayerId::BOB, options);
+        ComputerPlayer computerO(TicTacToeState::PlayerId::BOB, options);
+
+        // Whatever the reply, pondering finds the move ahead of time, and it is the same as the move found by searching
+        TicTacToeState           state;
+        TicTacToeState::MoveList replies;
+        state.generateMoves(&replies);
+        for (TicTacToeState::Move const & reply : replies)
+        {
+            ponderingO.ponder(state);
+            EXPECT_GT(ponderingO.totalStatistics().nodes, 0u);
+
+            TicTacToeState pondered(state);
+            TicTacToeState searched(state);
+            pondered.move(reply.row, reply.column);
+            searched.move(reply.row, reply.column);
+            ponderingO.move(&pondered);
+            computerO.move(&searched);
+            EXPECT_EQ(ponderingO.lastStatistics().nodes, 0u);
+            EXPECT_GT(computerO.lastStatistics().nodes, 0u);
+            EXPECT_EQ(pondered.board().value(), searched.board().value());
+        }
+    }
+}
+
+TEST(ComputerPlayer, Ponder_forgotten)
+{
+    ComputerPlayer::Options options;
+    options.engine = ComputerPlayer::Options::Engine::NEGAMAX;
+
+    TicTacToeState state;
+    TicTacToeState reply(state);
+    reply.move(1, 1);
+
+    // The replies are only used for the next move
+    ComputerPlayer computerO(TicTacToeState::PlayerId::BOB, options);
+    computerO.ponder(state);
+    TicTacToeState first(reply);
+    computerO.move(&first);
+    EXPECT_EQ(computerO.lastStatistics().nodes, 0u);
+    TicTacToeState second(reply);
+    computerO.move(&second);
+    EXPECT_GT(computerO.lastStatistics().nodes, 0u);
+
+    // The replies are forgotten when a new game starts
+    computerO.ponder(state);
+    computerO.reset();
+    TicTacToeState afterReset(reply);
+    computerO.move(&afterReset);
+    EXPECT_GT(computerO.lastStatistics().nodes, 0u);
+}
+
+TEST(ComputerPlayer, Cancel)
+{
+    ComputerPlayer::Options options;
+    options.engine = ComputerPlayer::Options::Engine::NEGAMAX;
+
+    for (int threads : { 1, 4 })
+    {
+        options.threads = threads;
+        ComputerPlayer computerX(TicTacToeState::PlayerId::ALICE, options);
+        ComputerPlayer uncancelledX(TicTacToeState::PlayerId::ALICE, options);
+
+        // Cancelling when nothing is in progress has no effect
+        TicTacToeState state;
+        TicTacToeState uncancelled;
+        computerX.cancel();
+        computerX.move(&state);
+        uncancelledX.move(&uncancelled);
+        EXPECT_EQ(state.board().value(), uncancelled.board().value());
+        if (threads == 1)
+        {
+            EXPECT_EQ(computerX.lastStatistics().nodes, uncancelledX.lastStatistics().nodes); // Not repeatable with threads
+        }
+
+        // A move cancelled while in progress is still made
+        TicTacToeState    cancelled;
+        std::atomic<bool> done(false);
+        std::thread       worker([&]() {
+            computerX.move(&cancelled);
+            done = true;
+        });
+        while (!done)
+        {
+            computerX.cancel();
+        }
+        worker.join();
+        EXPECT_EQ(cancelled.numberOfMoves(), 1);
+
+        // Pondering cancelled while in progress only keeps the moves that were finished
+        TicTacToeState    ponderState(uncancelled);
+        std::atomic<bool> ponderDone(false);
+        std::thread       ponderer([&]() {
+            computerX.ponder(ponderState);
+            ponderDone = true;
+        });
+        while (!ponderDone)
+        {
+            computerX.cancel();
+        }
+        ponderer.join();
+
+        TicTacToeState::MoveList replies;
+        ponderState.generateMoves(&replies);
+        for (TicTacToeState::Move const & reply : replies)
+        {
+            TicTacToeState pondered(ponderState);
+            TicTacToeState searched(ponderState);
+            pondered.move(reply.row, reply.column);
+            searched.move(reply.row, reply.column);
+            computerX.move(&pondered);
+            uncancelledX.move(&searched);
+            EXPECT_EQ(pondered.board().value(), searched.board().value());
+        }
+    }
+}
 } // namespace TicTacToe
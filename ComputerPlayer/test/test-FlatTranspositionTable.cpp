@@ -0,0 +1,54 @@
+#include "gtest/gtest.h"
+
+#include "ComputerPlayer/FlatTranspositionTable.h"
+
+namespace TicTacToe
+{
+using Bound = FlatTranspositionTable::Bound;
+using Entry = FlatTranspositionTable::Entry;
+
+TEST(FlatTranspositionTable, Constructor)
+{
+    FlatTranspositionTable table(100);
+    EXPECT_EQ(table.size(), 100u);
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(table.probe(i), nullptr);
+    }
+}
+
+TEST(FlatTranspositionTable, Store)
+{
+    FlatTranspositionTable table(10);
+    table.store(3, { 1.5f, 4, Bound::LOWER, 7, true });
+
+    Entry const * pEntry = table.probe(3);
+    ASSERT_NE(pEntry, nullptr);
+    EXPECT_EQ(pEntry->value, 1.5f);
+    EXPECT_EQ(pEntry->depth, 4);
+    EXPECT_EQ(pEntry->bound, Bound::LOWER);
+    EXPECT_EQ(pEntry->bestMove, 7);
+    EXPECT_TRUE(pEntry->complete);
+    EXPECT_EQ(table.probe(2), nullptr);
+    EXPECT_EQ(table.probe(4), nullptr);
+
+    // A new result replaces the old one
+    table.store(3, { -2.0f, 2, Bound::EXACT, 1, false });
+    pEntry = table.probe(3);
+    ASSERT_NE(pEntry, nullptr);
+    EXPECT_EQ(pEntry->value, -2.0f);
+    EXPECT_EQ(pEntry->depth, 2);
+    EXPECT_EQ(pEntry->bound, Bound::EXACT);
+}
+
+TEST(FlatTranspositionTable, Clear)
+{
+    FlatTranspositionTable table(10);
+    table.store(0, { 1.0f, 0, Bound::EXACT, -1, true });
+    table.store(9, { 1.0f, 1, Bound::UPPER, 2, false });
+    table.clear();
+    EXPECT_EQ(table.probe(0), nullptr);
+    EXPECT_EQ(table.probe(9), nullptr);
+    EXPECT_EQ(table.size(), 10u);
+}
+} // namespace TicTacToe
@@ -0,0 +1,78 @@
+#include "gtest/gtest.h"
+
+#include "ComputerPlayer/HistoryOrdering.h"
+#include "TicTacToeState/DynamicTicTacToeState.h"
+
+#include <vector>
+
+namespace TicTacToe
+{
+using Ordering = HistoryOrdering<DynamicTicTacToeState>;
+
+// Returns the indexes of the cells of the moves in the list
+static std::vector<int> Indexes(DynamicTicTacToeState const & state, DynamicTicTacToeState::MoveList const & moves)
+{
+    std::vector<int> indexes;
+    for (auto const & move : moves)
+    {
+        indexes.push_back(state.board().toIndex(move.row, move.column));
+    }
+    return indexes;
+}
+
+TEST(HistoryOrdering, Constructor)
+{
+    Ordering ordering;
+    for (int i = 0; i < 16; ++i)
+    {
+        EXPECT_EQ(ordering.history(DynamicTicTacToeState::PlayerId::ALICE, i), 0u);
+        EXPECT_EQ(ordering.history(DynamicTicTacToeState::PlayerId::BOB, i), 0u);
+        EXPECT_EQ(ordering.killer(i), -1);
+    }
+}
+
+TEST(HistoryOrdering, Order)
+{
+    DynamicTicTacToeState           state(DynamicBoard(2, 3, 2));
+    DynamicTicTacToeState::MoveList moves;
+    Ordering                        ordering;
+
+    // Without a hash move, a killer move or history, the moves stay in index order
+    state.generateMoves(&moves);
+    ordering.order(state, &moves, 0);
+    EXPECT_EQ(Indexes(state, moves), (std::vector<int>{ 0, 1, 2, 3, 4, 5 }));
+
+    // The hash move is first, then the killer move, then the rest by history
+    DynamicTicTacToeState::Move const & killer = moves[1];
+    DynamicTicTacToeState::Move const & good   = moves[5];
+    DynamicTicTacToeState::Move const & better = moves[2];
+    ordering.cutoff(state, good, 3, 1);
+    ordering.cutoff(state, better, 3, 2);
+    ordering.cutoff(state, killer, 0, 1);
+    EXPECT_EQ(ordering.killer(0), 1);
+    EXPECT_EQ(ordering.killer(3), 2);
+    EXPECT_EQ(ordering.history(DynamicTicTacToeState::PlayerId::ALICE, 2), 4u);
+    state.generateMoves(&moves);
+    ordering.order(state, &moves, 0, 4);
+    EXPECT_EQ(Indexes(state, moves), (std::vector<int>{ 4, 1, 2, 5, 0, 3 }));
+
+    // The history of one player does not affect the other's moves
+    state.move(0, 0);
+    state.generateMoves(&moves);
+    ordering.order(state, &moves, 5);
+    EXPECT_EQ(Indexes(state, moves), (std::vector<int>{ 1, 2, 3, 4, 5 }));
+}
+
+TEST(HistoryOrdering, Clear)
+{
+    DynamicTicTacToeState           state(DynamicBoard(3, 3, 3));
+    DynamicTicTacToeState::MoveList moves;
+    state.generateMoves(&moves);
+
+    Ordering ordering;
+    ordering.cutoff(state, moves[4], 2, 3);
+    ordering.clear();
+    EXPECT_EQ(ordering.killer(2), -1);
+    EXPECT_EQ(ordering.history(DynamicTicTacToeState::PlayerId::ALICE, 4), 0u);
+}
+} // namespace TicTacToe
@@ -0,0 +1,74 @@
+#include "gtest/gtest.h"
+
+#include "SearchTests.h"
+
+#include "Components/Board.h"
+#include "ComputerPlayer/LazySmpSearch.h"
+#include "ComputerPlayer/MoveOrdering.h"
+#include "ComputerPlayer/NegamaxSearch.h"
+#include "ComputerPlayer/TicTacToeEvaluator.h"
+#include "TicTacToeState/TicTacToeState.h"
+
+namespace TicTacToe
+{
+using LazySmpSearcher = LazySmpSearch<TicTacToeState, TicTacToeEvaluator, MoveOrdering>;
+
+TEST(LazySmpSearch, Constructor)
+{
+    TicTacToeEvaluator evaluator;
+    EXPECT_EQ(LazySmpSearcher(evaluator, 8, 1024, 3).numberOfThreads(), 3);
+    EXPECT_GE(LazySmpSearcher(evaluator, 8, 1024).numberOfThreads(), 1);
+}
+
+TEST(LazySmpSearch, FindBestMove)
+{
+    TicTacToeEvaluator evaluator;
+    for (int maxDepth : { 2, 4 })
+    {
+        LazySmpSearcher lazySmp(evaluator, maxDepth, 65536, 4);
+        Searcher        serial(evaluator, maxDepth);
+        TicTacToeState  state;
+        CompareWithSerial(lazySmp, serial, state);
+    }
+
+    // The full depth used by ComputerPlayer, from the first two plies
+    {
+        LazySmpSearcher          lazySmp(evaluator, 8, 65536, 4);
+        Searcher                 serial(evaluator, 8);
+        TicTacToeState           state;
+        TicTacToeState::MoveList moves;
+        EXPECT_EQ(IndexOf(lazySmp.findBestMove(state)), IndexOf(serial.findBestMove(state)));
+        EXPECT_EQ(lazySmp.completedDepth(), 8);
+        state.generateMoves(&moves);
+        for (auto const & move : moves)
+        {
+            state.move(move.row, move.column);
+            EXPECT_EQ(IndexOf(lazySmp.findBestMove(state)), IndexOf(serial.findBestMove(state)));
+            state.unmove();
+        }
+    }
+}
+
+TEST(LazySmpSearch, FindBestMove_budget)
+{
+    // The budget applies to the main thread, which still returns a move
+    TicTacToeEvaluator      evaluator;
+    LazySmpSearcher         lazySmp(evaluator, 8, 65536, 4);
+    TicTacToeState          state;
+    LazySmpSearcher::Budget budget;
+    budget.nodes = 1;
+    EXPECT_EQ(IndexOf(lazySmp.findBestMove(state, budget)), 4);
+    EXPECT_EQ(lazySmp.completedDepth(), 0);
+}
+
+TEST(LazySmpSearch, Statistics)
+{
+    TicTacToeEvaluator evaluator;
+    LazySmpSearcher    lazySmp(evaluator, 8, 65536, 2);
+    TicTacToeState     state;
+    lazySmp.findBestMove(state);
+    EXPECT_GT(lazySmp.statistics().nodes, 1u);
+    lazySmp.resetStatistics();
+    EXPECT_EQ(lazySmp.statistics().nodes, 0u);
+}
+} // namespace TicTacToe
@@ -0,0 +1,119 @@
+#include "gtest/gtest.h"
+
+#include "Components/Board.h"
+#include "ComputerPlayer/MoveOrdering.h"
+#include "TicTacToeState/TicTacToeState.h"
+
+#include <vector>
+
+namespace TicTacToe
+{
+// Returns the indexes of the cells of the moves in the list
+static std::vector<int> Indexes(TicTacToeState::MoveList const & moves)
+{
+    std::vector<int> indexes;
+    for (auto const & move : moves)
+    {
+        indexes.push_back(Board::toIndex(move.row, move.column));
+    }
+    return indexes;
+}
+
+TEST(MoveOrdering, Constructor)
+{
+    MoveOrdering ordering;
+    for (int i = 0; i < 9; ++i)
+    {
+        EXPECT_EQ(ordering.history(TicTacToeState::PlayerId::ALICE, i), 0u);
+        EXPECT_EQ(ordering.history(TicTacToeState::PlayerId::BOB, i), 0u);
+        EXPECT_EQ(ordering.killer(i), -1);
+    }
+}
+
+TEST(MoveOrdering, Category)
+{
+    // Positional categories on an empty board
+    {
+        TicTacToeState state;
+        EXPECT_EQ(MoveOrdering::category(state, 4), MoveOrdering::CENTER);
+        for (int i : { 0, 2, 6, 8 })
+        {
+            EXPECT_EQ(MoveOrdering::category(state, i), MoveOrdering::CORNER);
+        }
+        for (int i : { 1, 3, 5, 7 })
+        {
+            EXPECT_EQ(MoveOrdering::category(state, i), MoveOrdering::EDGE);
+        }
+    }
+
+    // X can win at 2 and must block at 5
+    {
+        Board board({{
+                        Board::Cell::X,       Board::Cell::X,       Board::Cell::NEITHER,
+                        Board::Cell::O,       Board::Cell::O,       Board::Cell::NEITHER,
+                        Board::Cell::NEITHER, Board::Cell::NEITHER, Board::Cell::NEITHER
+                    }});
+        TicTacToeState state(board, TicTacToeState::PlayerId::ALICE);
+        EXPECT_EQ(MoveOrdering::category(state, 2), MoveOrdering::WIN);
+        EXPECT_EQ(MoveOrdering::category(state, 5), MoveOrdering::BLOCK);
+    }
+
+    // X forks at 8 (right column and bottom row)
+    {
+        Board board({{
+                        Board::Cell::NEITHER, Board::Cell::O,       Board::Cell::X,
+                        Board::Cell::NEITHER, Board::Cell::O,       Board::Cell::NEITHER,
+                        Board::Cell::X,       Board::Cell::NEITHER, Board::Cell::NEITHER
+                    }});
+        TicTacToeState state(board, TicTacToeState::PlayerId::ALICE);
+        EXPECT_EQ(MoveOrdering::category(state, 8), MoveOrdering::FORK);
+    }
+}
+
+TEST(MoveOrdering, Order)
+{
+    MoveOrdering ordering;
+
+    // Win, then block, then the center, corners and edges, each in index order
+    Board board({{
+                    Board::Cell::X,       Board::Cell::X,       Board::Cell::NEITHER,
+                    Board::Cell::NEITHER, Board::Cell::NEITHER, Board::Cell::NEITHER,
+                    Board::Cell::O,       Board::Cell::O,       Board::Cell::NEITHER
+                }});
+    TicTacToeState           state(board, TicTacToeState::PlayerId::ALICE);
+    TicTacToeState::MoveList moves;
+    state.generateMoves(&moves);
+    ordering.order(state, &moves, 0);
+    EXPECT_EQ(Indexes(moves), (std::vector<int> { 2, 8, 4, 3, 5 }));
+
+    // The hash move comes first
+    state.generateMoves(&moves);
+    ordering.order(state, &moves, 0, 5);
+    EXPECT_EQ(Indexes(moves), (std::vector<int> { 5, 2, 8, 4, 3 }));
+}
+
+TEST(MoveOrdering, Cutoff)
+{
+    MoveOrdering             ordering;
+    TicTacToeState           state;
+    TicTacToeState::MoveList moves;
+    state.generateMoves(&moves);
+
+    // A killer move is searched before the positional categories
+    ordering.cutoff(state, moves[7], 3, 2);
+    EXPECT_EQ(ordering.killer(3), 7);
+    EXPECT_EQ(ordering.history(TicTacToeState::PlayerId::ALICE, 7), 4u);
+    EXPECT_EQ(ordering.history(TicTacToeState::PlayerId::BOB, 7), 0u);
+    ordering.order(state, &moves, 3);
+    EXPECT_EQ(Indexes(moves), (std::vector<int> { 7, 4, 0, 2, 6, 8, 1, 3, 5 }));
+
+    // At other plies, the history breaks ties within a category
+    state.generateMoves(&moves);
+    ordering.order(state, &moves, 0);
+    EXPECT_EQ(Indexes(moves), (std::vector<int> { 4, 0, 2, 6, 8, 7, 1, 3, 5 }));
+
+    ordering.clear();
+    EXPECT_EQ(ordering.killer(3), -1);
+    EXPECT_EQ(ordering.history(TicTacToeState::PlayerId::ALICE, 7), 0u);
+}
+} // namespace TicTacToe
@@ -0,0 +1,313 @@
+#include "gtest/gtest.h"
+
+#include "SearchTests.h"
+
+#include "Components/Board.h"
+#include "ComputerPlayer/MoveOrdering.h"
+#include "ComputerPlayer/NegamaxSearch.h"
+#include "ComputerPlayer/TicTacToeEvaluator.h"
+#include "TicTacToeState/TicTacToeState.h"
+
+#include <chrono>
+#include <limits>
+
+namespace TicTacToe
+{
+using UnorderedSearcher = NegamaxSearch<TicTacToeState, TicTacToeEvaluator, IndexOrdering>;
+
+// Returns the minimax value of a state searched to the specified depth, from the point of view of the player to move
+static float Minimax(TicTacToeEvaluator const & evaluator, TicTacToeState & state, int depth)
+{
+    if (state.isDone() || depth == 0)
+    {
+        float value = evaluator.evaluate(state);
+        return (state.whoseTurn() == TicTacToeState::PlayerId::ALICE) ? value : -value;
+    }
+
+    float                    best = -std::numeric_limits<float>::infinity();
+    TicTacToeState::MoveList moves;
+    state.generateMoves(&moves);
+    for (auto const & move : moves)
+    {
+        state.move(move.row, move.column);
+        float value = -Minimax(evaluator, state, depth - 1);
+        state.unmove();
+        if (value > best)
+            best = value;
+    }
+    return best;
+}
+
+// Returns the index of the first move with the highest minimax value
+static int ReferenceBestMove(TicTacToeEvaluator const & evaluator, TicTacToeState & state, int maxDepth)
+{
+    float                    best      = -std::numeric_limits<float>::infinity();
+    int                      bestIndex = -1;
+    TicTacToeState::MoveList moves;
+    state.generateMoves(&moves);
+    for (auto const & move : moves)
+    {
+        state.move(move.row, move.column);
+        float value = -Minimax(evaluator, state, maxDepth - 1);
+        state.unmove();
+        if (value > best)
+        {
+            best      = value;
+            bestIndex = IndexOf(move);
+        }
+    }
+    return bestIndex;
+}
+
+// Checks that the searcher and the reference agree for every state reachable from the given state
+template <typename S>
+static void CompareWithReference(TicTacToeEvaluator const & evaluator, S & searcher, TicTacToeState & state, int maxDepth)
+{
+    if (state.isDone())
+        return;
+
+    int rank = state.rank();
+    ASSERT_EQ(IndexOf(searcher.findBestMove(state)), ReferenceBestMove(evaluator, state, maxDepth));
+    ASSERT_EQ(state.rank(), rank); // The state is restored
+
+    TicTacToeState::MoveList moves;
+    state.generateMoves(&moves);
+    for (auto const & move : moves)
+    {
+        state.move(move.row, move.column);
+        CompareWithReference(evaluator, searcher, state, maxDepth);
+        state.unmove();
+    }
+}
+
+TEST(NegamaxSearch, Constructor)
+{
+    TicTacToeEvaluator evaluator;
+    ASSERT_NO_THROW(Searcher(evaluator, 1));
+    ASSERT_NO_THROW(Searcher(evaluator, 8));
+}
+
+TEST(NegamaxSearch, FindBestMove)
+{
+    TicTacToeEvaluator evaluator;
+
+    // X wins by completing the top row rather than blocking O
+    {
+        Board board({{
+                        Board::Cell::X,       Board::Cell::X,       Board::Cell::NEITHER,
+                        Board::Cell::O,       Board::Cell::O,       Board::Cell::NEITHER,
+                        Board::Cell::NEITHER, Board::Cell::NEITHER, Board::Cell::NEITHER
+                    }});
+        TicTacToeState state(board, TicTacToeState::PlayerId::ALICE);
+        Searcher       searcher(evaluator, 8);
+        EXPECT_EQ(IndexOf(searcher.findBestMove(state)), Board::toIndex(0, 2));
+    }
+
+    // O blocks X
+    {
+        Board board({{
+                        Board::Cell::X,       Board::Cell::NEITHER, Board::Cell::NEITHER,
+                        Board::Cell::NEITHER, Board::Cell::X,       Board::Cell::NEITHER,
+                        Board::Cell::O,       Board::Cell::NEITHER, Board::Cell::NEITHER
+                    }});
+        TicTacToeState state(board, TicTacToeState::PlayerId::BOB);
+        Searcher       searcher(evaluator, 8);
+        EXPECT_EQ(IndexOf(searcher.findBestMove(state)), Board::toIndex(2, 2));
+    }
+}
+
+TEST(NegamaxSearch, FindBestMove_reference)
+{
+    // Every reachable state at shallow depths, sharing one searcher so that the transposition table is reused
+    for (int maxDepth : { 1, 2, 3, 4 })
+    {
+        TicTacToeEvaluator evaluator;
+        {
+            Searcher       searcher(evaluator, maxDepth);
+            TicTacToeState state;
+            CompareWithReference(evaluator, searcher, state, maxDepth);
+        }
+        {
+            UnorderedSearcher searcher(evaluator, maxDepth);
+            TicTacToeState    state;
+            CompareWithReference(evaluator, searcher, state, maxDepth);
+        }
+    }
+
+    // The full depth used by ComputerPlayer, from the first two plies
+    {
+        TicTacToeEvaluator       evaluator;
+        Searcher                 searcher(evaluator, 8);
+        TicTacToeState           state;
+        TicTacToeState::MoveList moves;
+        EXPECT_EQ(IndexOf(searcher.findBestMove(state)), ReferenceBestMove(evaluator, state, 8));
+        state.generateMoves(&moves);
+        for (auto const & move : moves)
+        {
+            state.move(move.row, move.column);
+            EXPECT_EQ(IndexOf(searcher.findBestMove(state)), ReferenceBestMove(evaluator, state, 8));
+            state.unmove();
+        }
+    }
+}
+
+TEST(NegamaxSearch, FindBestMove_otherSize)
+{
+    Evaluator3x4 evaluator;
+    State3x4     state = LastColumnWin();
+    for (int maxDepth : { 1, 3 })
+    {
+        NegamaxSearch<State3x4, Evaluator3x4, IndexOrdering> searcher(evaluator, maxDepth);
+        State3x4::Move                                       move = searcher.findBestMove(state);
+        EXPECT_EQ(move.row, 2);
+        EXPECT_EQ(move.column, 3);
+        move = searcher.findBestMove(state, decltype(searcher)::Budget());
+        EXPECT_EQ(move.row, 2);
+        EXPECT_EQ(move.column, 3);
+    }
+}
+
+TEST(NegamaxSearch, Clear)
+{
+    TicTacToeEvaluator evaluator;
+    Searcher           searcher(evaluator, 8);
+    TicTacToeState     state;
+    int                before = IndexOf(searcher.findBestMove(state));
+    searcher.clear();
+    EXPECT_EQ(IndexOf(searcher.findBestMove(state)), before);
+}
+
+TEST(NegamaxSearch, Statistics)
+{
+    TicTacToeEvaluator evaluator;
+    Searcher           ordered(evaluator, 8);
+    UnorderedSearcher  unordered(evaluator, 8);
+    EXPECT_EQ(ordered.statistics().nodes, 0u);
+    EXPECT_EQ(ordered.statistics().cutoffs, 0u);
+
+    // Searching the best moves first prunes more of the tree
+    TicTacToeState state;
+    EXPECT_EQ(IndexOf(ordered.findBestMove(state)), IndexOf(unordered.findBestMove(state)));
+    EXPECT_GT(ordered.statistics().nodes, 0u);
+    EXPECT_GT(ordered.statistics().cutoffs, 0u);
+    EXPECT_LT(ordered.statistics().nodes, unordered.statistics().nodes);
+
+    // The root is never a leaf or cut off, and the flat table never has collisions or overwrites
+    Searcher::Statistics const & statistics = ordered.statistics();
+    EXPECT_GT(statistics.leaves, 0u);
+    EXPECT_LT(statistics.leaves, statistics.nodes);
+    EXPECT_EQ(statistics.cutoffsByPly[0], 0u);
+    uint64_t cutoffs = 0;
+    for (uint64_t count : statistics.cutoffsByPly)
+    {
+        cutoffs += count;
+    }
+    EXPECT_EQ(cutoffs, statistics.cutoffs);
+    EXPECT_EQ(statistics.probes + statistics.leaves + 1, statistics.nodes);
+    EXPECT_GT(statistics.hits, 0u);
+    EXPECT_LE(statistics.hits, statistics.probes);
+    EXPECT_EQ(statistics.collisions, 0u);
+    EXPECT_EQ(statistics.overwrites, 0u);
+
+    ordered.resetStatistics();
+    EXPECT_EQ(ordered.statistics().nodes, 0u);
+    EXPECT_EQ(ordered.statistics().cutoffs, 0u);
+    EXPECT_EQ(ordered.statistics().probes, 0u);
+}
+
+// Checks that iterative deepening without a budget and a fixed-depth search agree for every state reachable from the given
+// state
+static void CompareIterativeDeepening(Searcher & iterative, Searcher & fixed, TicTacToeState & state, int maxDepth)
+{
+    if (state.isDone())
+        return;
+
+    ASSERT_EQ(IndexOf(iterative.findBestMove(state, Searcher::Budget())), IndexOf(fixed.findBestMove(state)));
+    ASSERT_FALSE(iterative.aborted());
+    ASSERT_GE(iterative.completedDepth(), 1);
+    ASSERT_LE(iterative.completedDepth(), maxDepth);
+
+    TicTacToeState::MoveList moves;
+    state.generateMoves(&moves);
+    for (auto const & move : moves)
+    {
+        state.move(move.row, move.column);
+        CompareIterativeDeepening(iterative, fixed, state, maxDepth);
+        state.unmove();
+    }
+}
+
+TEST(NegamaxSearch, FindBestMove_iterativeDeepening)
+{
+    TicTacToeEvaluator evaluator;
+    for (int maxDepth : { 3, 8 })
+    {
+        Searcher       iterative(evaluator, maxDepth);
+        Searcher       fixed(evaluator, maxDepth);
+        TicTacToeState state;
+        CompareIterativeDeepening(iterative, fixed, state, maxDepth);
+    }
+
+    // The game can last 9 more plies, so every depth is searched
+    {
+        Searcher       searcher(evaluator, 8);
+        TicTacToeState state;
+        searcher.findBestMove(state, Searcher::Budget());
+        EXPECT_EQ(searcher.completedDepth(), 8);
+    }
+
+    // Every line of play ends within 2 plies, so deeper searches are not needed
+    {
+        Board board({{
+                        Board::Cell::X,       Board::Cell::O, Board::Cell::X,
+                        Board::Cell::X,       Board::Cell::O, Board::Cell::O,
+                        Board::Cell::NEITHER, Board::Cell::X, Board::Cell::NEITHER
+                    }});
+        TicTacToeState state(board, TicTacToeState::PlayerId::BOB);
+        Searcher       searcher(evaluator, 8);
+        searcher.findBestMove(state, Searcher::Budget());
+        EXPECT_EQ(searcher.completedDepth(), 2);
+    }
+}
+
+TEST(NegamaxSearch, FindBestMove_budget)
+{
+    TicTacToeEvaluator evaluator;
+
+    // If the budget runs out before the first search completes, the first move in the ordering (the center) is returned
+    {
+        Searcher         searcher(evaluator, 8);
+        TicTacToeState   state;
+        Searcher::Budget budget;
+        budget.nodes = 1;
+        EXPECT_EQ(IndexOf(searcher.findBestMove(state, budget)), 4);
+        EXPECT_TRUE(searcher.aborted());
+        EXPECT_EQ(searcher.completedDepth(), 0);
+    }
+
+    // The search stops when it has searched the number of states in the budget
+    {
+        Searcher         searcher(evaluator, 8);
+        TicTacToeState   state;
+        Searcher::Budget budget;
+        budget.nodes = 100;
+        searcher.findBestMove(state, budget);
+        EXPECT_TRUE(searcher.aborted());
+        EXPECT_GT(searcher.completedDepth(), 0);
+        EXPECT_LT(searcher.completedDepth(), 8);
+        EXPECT_LE(searcher.statistics().nodes, budget.nodes);
+        EXPECT_EQ(state.rank(), 0); // The state is restored
+    }
+
+    // A generous time budget does not cut the search short
+    {
+        Searcher         searcher(evaluator, 8);
+        TicTacToeState   state;
+        Searcher::Budget budget;
+        budget.time = std::chrono::seconds(60);
+        searcher.findBestMove(state, budget);
+        EXPECT_FALSE(searcher.aborted());
+        EXPECT_EQ(searcher.completedDepth(), 8);
+    }
+}
+} // namespace TicTacToe
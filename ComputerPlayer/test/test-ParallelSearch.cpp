@@ -0,0 +1,143 @@
+#include "gtest/gtest.h"
+
+#include "SearchTests.h"
+
+#include "Components/Board.h"
+#include "ComputerPlayer/MoveOrdering.h"
+#include "ComputerPlayer/NegamaxSearch.h"
+#include "ComputerPlayer/ParallelSearch.h"
+#include "ComputerPlayer/TicTacToeEvaluator.h"
+#include "TicTacToeState/TicTacToeState.h"
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+
+namespace TicTacToe
+{
+using ParallelSearcher = ParallelSearch<TicTacToeState, TicTacToeEvaluator, MoveOrdering>;
+
+TEST(ParallelSearch, Constructor)
+{
+    TicTacToeEvaluator evaluator;
+    EXPECT_EQ(ParallelSearcher(evaluator, 8, 3).numberOfThreads(), 3);
+    EXPECT_GE(ParallelSearcher(evaluator, 8).numberOfThreads(), 1);
+}
+
+TEST(ParallelSearch, FindBestMove)
+{
+    TicTacToeEvaluator evaluator;
+    for (int maxDepth : { 2, 4 })
+    {
+        ParallelSearcher parallel(evaluator, maxDepth, 4);
+        Searcher         serial(evaluator, maxDepth);
+        TicTacToeState   state;
+        CompareWithSerial(parallel, serial, state);
+    }
+
+    // The full depth used by ComputerPlayer, from the first two plies
+    {
+        ParallelSearcher         parallel(evaluator, 8, 4);
+        Searcher                 serial(evaluator, 8);
+        TicTacToeState           state;
+        TicTacToeState::MoveList moves;
+        EXPECT_EQ(IndexOf(parallel.findBestMove(state)), IndexOf(serial.findBestMove(state)));
+        state.generateMoves(&moves);
+        for (auto const & move : moves)
+        {
+            state.move(move.row, move.column);
+            EXPECT_EQ(IndexOf(parallel.findBestMove(state)), IndexOf(serial.findBestMove(state)));
+            state.unmove();
+        }
+    }
+}
+
+TEST(ParallelSearch, FindBestMove_otherSize)
+{
+    Evaluator3x4                                          evaluator;
+    ParallelSearch<State3x4, Evaluator3x4, IndexOrdering> searcher(evaluator, 3, 2);
+    State3x4::Move                                        move = searcher.findBestMove(LastColumnWin());
+    EXPECT_EQ(move.row, 2);
+    EXPECT_EQ(move.column, 3);
+}
+
+TEST(ParallelSearch, Statistics)
+{
+    TicTacToeEvaluator evaluator;
+    ParallelSearcher   parallel(evaluator, 8, 2);
+    TicTacToeState     state;
+    parallel.findBestMove(state);
+    EXPECT_GT(parallel.statistics().nodes, 1u);
+    parallel.resetStatistics();
+    EXPECT_EQ(parallel.statistics().nodes, 0u);
+    EXPECT_EQ(parallel.statistics().cutoffs, 0u);
+}
+
+TEST(ParallelSearch, FindBestMove_stop)
+{
+    // A stopped search still returns a legal move, without searching any moves
+    TicTacToeEvaluator evaluator;
+    ParallelSearcher   parallel(evaluator, 8, 2);
+    TicTacToeState     state;
+    std::atomic<bool>  stop(true);
+    int                index = IndexOf(parallel.findBestMove(state, &stop));
+    EXPECT_GE(index, 0);
+    EXPECT_LT(index, 9);
+    EXPECT_EQ(parallel.statistics().nodes, 1u);
+}
+
+// An evaluator that sets a stop flag after a number of evaluations
+struct StoppingEvaluator
+{
+    TicTacToeEvaluator  evaluator;
+    mutable uint64_t    count = 0;
+    uint64_t            limit = 0;
+    std::atomic<bool> * pStop = nullptr;
+
+    float evaluate(TicTacToeState const & state) const
+    {
+        if (++count == limit)
+            *pStop = true;
+        return evaluator.evaluate(state);
+    }
+};
+
+TEST(ParallelSearch, FindBestMove_stopDuringMove)
+{
+    using StoppingSearcher         = NegamaxSearch<TicTacToeState, StoppingEvaluator, MoveOrdering>;
+    using StoppingParallelSearcher = ParallelSearch<TicTacToeState, StoppingEvaluator, MoveOrdering>;
+
+    // X has three threats, so every move loses for O. A move whose search is stopped has a meaningless value, which is
+    // higher than a loss.
+    TicTacToeState state;
+    state.move(0, 0);
+    state.move(2, 0);
+    state.move(0, 2);
+    state.move(2, 1);
+    state.move(2, 2);
+
+    // The first move in the move ordering is the one chosen if no other move is searched
+    TicTacToeState::MoveList moves;
+    state.generateMoves(&moves);
+    MoveOrdering().order(state, &moves, 0, -1);
+
+    // Count the evaluations made by the search of the first move
+    std::atomic<bool> stop(false);
+    StoppingEvaluator evaluator;
+    evaluator.pStop = &stop;
+    StoppingSearcher counter(evaluator, 8);
+    counter.searchMove(state, moves[0], -std::numeric_limits<float>::infinity());
+    uint64_t firstMove = evaluator.count;
+
+    // Stop the search during the second move, which must not be chosen
+    for (uint64_t extra : { 1, 2 })
+    {
+        stop            = false;
+        evaluator.count = 0;
+        evaluator.limit = firstMove + extra;
+        StoppingParallelSearcher parallel(evaluator, 8, 1);
+        EXPECT_EQ(IndexOf(parallel.findBestMove(state, &stop)), IndexOf(moves[0]));
+        EXPECT_TRUE(stop);
+    }
+}
+} // namespace TicTacToe
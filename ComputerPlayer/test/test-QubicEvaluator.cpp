@@ -0,0 +1,55 @@
+#include "gtest/gtest.h"
+
+#include "ComputerPlayer/QubicEvaluator.h"
+#include "TicTacToeState/QubicState.h"
+
+namespace TicTacToe
+{
+TEST(QubicEvaluator, Evaluate)
+{
+    QubicEvaluator evaluator;
+
+    // The empty cube is even
+    QubicState state;
+    EXPECT_EQ(evaluator.evaluate(state), 0.0f);
+
+    // A mark in a corner is on 7 lines, and a mark on an edge is on 4
+    state.move(0, 0, 0);
+    EXPECT_EQ(evaluator.evaluate(state), 7.0f);
+    state.move(0, 0, 1);
+    EXPECT_EQ(evaluator.evaluate(state), 6.0f - 3.0f); // The first row is blocked for both players
+
+    // Two Xs in the first column: the column is worth 10, and the other 5 open lines of the corner and 3 lines of the new
+    // mark are worth 1 each
+    state.move(0, 1, 0);
+    EXPECT_EQ(evaluator.evaluate(state), 10.0f + 5.0f + 3.0f - 3.0f);
+
+    // The evaluator is symmetric in the players
+    QubicState mirrored(state.mask(BoardCell::O), state.mask(BoardCell::X), QubicState::PlayerId::ALICE);
+    EXPECT_EQ(evaluator.evaluate(mirrored), -evaluator.evaluate(state));
+
+    // The virtual function returns the same value
+    GamePlayer::GameState const & base = state;
+    EXPECT_EQ(evaluator.evaluate(base), evaluator.evaluate(state));
+}
+
+TEST(QubicEvaluator, Win)
+{
+    QubicEvaluator evaluator;
+    QubicState     state;
+    for (int i = 0; i < 3; ++i)
+    {
+        state.move(0, i, i);
+        state.move(3, 0, i);
+    }
+    state.move(0, 3, 3);
+    EXPECT_EQ(state.winner(), BoardCell::X);
+    EXPECT_EQ(evaluator.evaluate(state), evaluator.aliceWinsValue());
+
+    state.unmove();
+    state.move(3, 3, 3);
+    state.move(3, 0, 3);
+    EXPECT_EQ(state.winner(), BoardCell::O);
+    EXPECT_EQ(evaluator.evaluate(state), evaluator.bobWinsValue());
+}
+} // namespace TicTacToe
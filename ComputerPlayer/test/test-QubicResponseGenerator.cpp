@@ -0,0 +1,120 @@
+#include "gtest/gtest.h"
+
+#include "ComputerPlayer/QubicEvaluator.h"
+#include "ComputerPlayer/QubicResponseGenerator.h"
+#include "GamePlayer/GameTree.h"
+#include "GamePlayer/TranspositionTable.h"
+#include "TicTacToeState/QubicState.h"
+
+#include <memory>
+
+namespace TicTacToe
+{
+// Deletes the responses returned by a response generator
+static void deleteResponses(std::vector<GamePlayer::GameState *> const & responses)
+{
+    for (GamePlayer::GameState * pResponse : responses)
+    {
+        delete pResponse;
+    }
+}
+
+TEST(QubicResponseGenerator, Generate)
+{
+    // From the empty cube, every cell is a move, and the 16 cells on 7 lines come first
+    QubicState           state;
+    QubicState::MoveList moves;
+    QubicResponseGenerator::generate(state, &moves);
+    ASSERT_EQ(moves.size(), 64);
+    EXPECT_EQ(moves[0].index, 0);
+    for (int i = 0; i < moves.size(); ++i)
+    {
+        EXPECT_EQ(QubicState::Geometry::LINES_THROUGH[moves[i].index].count, (i < 16) ? 7 : 4);
+        EXPECT_EQ(moves[i].cell, BoardCell::X);
+    }
+
+    // O must block X's three in a line
+    state.move(0, 0, 0);
+    state.move(3, 3, 0);
+    state.move(1, 1, 1);
+    state.move(3, 3, 1);
+    state.move(2, 2, 2);
+    QubicResponseGenerator::generate(state, &moves);
+    ASSERT_EQ(moves.size(), 1);
+    EXPECT_EQ(moves[0].index, QubicState::toIndex(3, 3, 3));
+    EXPECT_EQ(moves[0].cell, BoardCell::O);
+
+    // O's block makes a threat in the last row, which X must block in turn
+    state.move(3, 3, 3);
+    QubicResponseGenerator::generate(state, &moves);
+    ASSERT_EQ(moves.size(), 1);
+    EXPECT_EQ(moves[0].index, QubicState::toIndex(3, 3, 2));
+    EXPECT_EQ(moves[0].cell, BoardCell::X);
+
+    // A win comes before a block. X and O both have three in a row.
+    QubicState::Mask xs = QubicState::Mask(0x7);
+    QubicState::Mask os = QubicState::Mask(0x7) << 60;
+    QubicResponseGenerator::generate(QubicState(xs, os, QubicState::PlayerId::ALICE), &moves);
+    ASSERT_EQ(moves.size(), 1);
+    EXPECT_EQ(moves[0].index, 3);
+    QubicResponseGenerator::generate(QubicState(xs, os, QubicState::PlayerId::BOB), &moves);
+    ASSERT_EQ(moves.size(), 1);
+    EXPECT_EQ(moves[0].index, 63);
+
+    // There are no moves when the game is over
+    QubicState won(xs, os, QubicState::PlayerId::ALICE);
+    won.move(3);
+    EXPECT_EQ(won.winner(), BoardCell::X);
+    QubicResponseGenerator::generate(won, &moves);
+    EXPECT_TRUE(moves.empty());
+}
+
+TEST(QubicResponseGenerator, Responses)
+{
+    QubicResponseGenerator generator;
+    QubicState             state;
+    state.move(1, 2, 3);
+
+    std::vector<GamePlayer::GameState *> responses = generator(state, 1);
+    ASSERT_EQ(responses.size(), 63u);
+    EXPECT_EQ(generator.generatedStates(), 63u);
+    for (GamePlayer::GameState * pResponse : responses)
+    {
+        QubicState const * pQubic = dynamic_cast<QubicState const *>(pResponse);
+        ASSERT_NE(pQubic, nullptr);
+        EXPECT_EQ(pQubic->numberOfMoves(), 2);
+        EXPECT_EQ(pQubic->whoseTurn(), QubicState::PlayerId::ALICE);
+        EXPECT_EQ(pQubic->lastMove().cell, BoardCell::O);
+        EXPECT_EQ(pQubic->at(1, 2, 3), BoardCell::X);
+    }
+    deleteResponses(responses);
+
+    generator.resetGeneratedStates();
+    EXPECT_EQ(generator.generatedStates(), 0u);
+}
+
+TEST(QubicResponseGenerator, GameTree)
+{
+    // X can make two threats at once by playing in the corner, and O can only block one of them. A game tree searching 3
+    // plies finds the fork.
+    QubicState::Mask xs = (QubicState::Mask(1) << 1) | (QubicState::Mask(1) << 2) | (QubicState::Mask(1) << 4) |
+                          (QubicState::Mask(1) << 8);
+    QubicState::Mask os = (QubicState::Mask(1) << 63) | (QubicState::Mask(1) << 58) | (QubicState::Mask(1) << 45) |
+                          (QubicState::Mask(1) << 39);
+    QubicState       state(xs, os, QubicState::PlayerId::ALICE);
+    ASSERT_EQ(state.threats(BoardCell::X), 0u);
+    ASSERT_EQ(state.threats(BoardCell::O), 0u);
+
+    QubicResponseGenerator generator;
+    GamePlayer::GameTree   tree(std::make_shared<GamePlayer::TranspositionTable>(1 << 16, 3),
+                              std::make_shared<QubicEvaluator>(),
+                              [&generator] (GamePlayer::GameState const & s, int depth) { return generator(s, depth); },
+                              3);
+    auto pState = std::make_shared<QubicState>(state);
+    tree.findBestResponse(pState);
+    auto pResponse = std::dynamic_pointer_cast<QubicState>(pState->response_);
+    ASSERT_TRUE(pResponse);
+    EXPECT_EQ(pResponse->lastMove().index, 0);
+    EXPECT_GT(generator.generatedStates(), 0u);
+}
+} // namespace TicTacToe
@@ -0,0 +1,160 @@
+#include "gtest/gtest.h"
+
+#include "ComputerPlayer/DynamicTicTacToeEvaluator.h"
+#include "ComputerPlayer/SearchPlayer.h"
+#include "ComputerPlayer/TicTacToeEvaluator.h"
+#include "TicTacToeState/DynamicTicTacToeState.h"
+#include "TicTacToeState/TicTacToeState.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace TicTacToe
+{
+using DynamicPlayer = SearchPlayer<DynamicTicTacToeState, DynamicTicTacToeEvaluator>;
+using Player3x3     = SearchPlayer<TicTacToeState, TicTacToeEvaluator>;
+using Player444     = SearchPlayer<BasicTicTacToeState<4, 4, 4>, BasicTicTacToeEvaluator<4, 4, 4>>;
+
+TEST(SearchPlayer, Draw)
+{
+    // Perfect play from both sides is a draw, and the 3x3 game is searched to the end
+    Player3x3      alice(TicTacToeState::PlayerId::ALICE);
+    Player3x3      bob(TicTacToeState::PlayerId::BOB);
+    TicTacToeState state;
+    while (!state.isDone())
+    {
+        (state.whoseTurn() == TicTacToeState::PlayerId::ALICE ? alice : bob).move(&state);
+    }
+    EXPECT_TRUE(state.isDraw());
+    EXPECT_LE(alice.completedDepth(), 9);
+}
+
+TEST(SearchPlayer, TakesWin)
+{
+    // X has 3 in the first row of a 4x4 board, and O threatens to win in the last row. X wins now instead of blocking.
+    DynamicBoard board(4, 4, 4);
+    for (int i = 0; i < 3; ++i)
+    {
+        board.set(0, i, BoardCell::X);
+        board.set(3, i + 1, BoardCell::O);
+    }
+    board.set(1, 0, BoardCell::O);
+    board.set(2, 1, BoardCell::X);
+    DynamicTicTacToeState state(board, DynamicTicTacToeState::PlayerId::ALICE);
+    DynamicPlayer         player(DynamicTicTacToeState::PlayerId::ALICE);
+    player.move(&state);
+    EXPECT_EQ(state.winner(), BoardCell::X);
+    EXPECT_EQ(state.lastMove().row, 0);
+    EXPECT_EQ(state.lastMove().column, 3);
+}
+
+TEST(SearchPlayer, Blocks)
+{
+    // O must block the X threat on the diagonal of a 5x5 board with 4 in a line
+    DynamicTicTacToeState state(DynamicBoard(5, 5, 4));
+    state.move(1, 1); // X
+    state.move(0, 0); // O
+    state.move(2, 2); // X
+    state.move(4, 0); // O
+    state.move(3, 3); // X, threatening (4, 4)
+    DynamicPlayer::Options options;
+    options.maxDepth = 2;
+    DynamicPlayer player(DynamicTicTacToeState::PlayerId::BOB, options);
+    player.move(&state);
+    EXPECT_FALSE(state.isDone());
+    EXPECT_EQ(state.lastMove().row, 4);
+    EXPECT_EQ(state.lastMove().column, 4);
+}
+
+TEST(SearchPlayer, Compiled)
+{
+    // The player plays the compiled sizes the same as it plays the dynamic ones
+    Player444::Options options;
+    options.maxDepth = 3;
+    Player444                    compiled(BasicTicTacToeState<4, 4, 4>::PlayerId::ALICE, options);
+    BasicTicTacToeState<4, 4, 4> state;
+    compiled.move(&state);
+    EXPECT_EQ(compiled.completedDepth(), 3);
+
+    DynamicPlayer::Options dynamicOptions;
+    dynamicOptions.maxDepth = 3;
+    DynamicPlayer         dynamic(DynamicTicTacToeState::PlayerId::ALICE, dynamicOptions);
+    DynamicTicTacToeState dynamicState(DynamicBoard(4, 4, 4));
+    dynamic.move(&dynamicState);
+    EXPECT_EQ(dynamicState.lastMove().row, state.lastMove().row);
+    EXPECT_EQ(dynamicState.lastMove().column, state.lastMove().column);
+}
+
+TEST(SearchPlayer, Table)
+{
+    // Each search of the iterative deepening uses the results of the previous one
+    Player444::Options options;
+    options.maxDepth = 4;
+    Player444                    player(BasicTicTacToeState<4, 4, 4>::PlayerId::ALICE, options);
+    BasicTicTacToeState<4, 4, 4> state;
+    player.move(&state);
+    EXPECT_GT(player.statistics().probes, 0u);
+    EXPECT_GT(player.statistics().hits, 0u);
+}
+
+TEST(SearchPlayer, BigBoard)
+{
+    // The cells of a 12x12 board have indexes too big for a table entry, but O still blocks X's threat at the last cell
+    DynamicTicTacToeState state(DynamicBoard(12, 12, 4));
+    state.move(8, 8);   // X
+    state.move(0, 0);   // O
+    state.move(9, 9);   // X
+    state.move(0, 11);  // O
+    state.move(10, 10); // X, threatening (7, 7) and (11, 11)
+    state.move(7, 7);   // O
+    state.move(5, 5);   // X
+    DynamicPlayer::Options options;
+    options.maxDepth = 2;
+    DynamicPlayer player(DynamicTicTacToeState::PlayerId::BOB, options);
+    player.move(&state);
+    EXPECT_EQ(state.lastMove().row, 11);
+    EXPECT_EQ(state.lastMove().column, 11);
+}
+
+TEST(SearchPlayer, Cancel)
+{
+    // Without a limit on time or depth, the search of an empty 7x7 board would not finish, but a move is made once it is
+    // cancelled
+    DynamicPlayer::Options options;
+    options.timeBudget = std::chrono::milliseconds(0);
+    DynamicPlayer         player(DynamicTicTacToeState::PlayerId::ALICE, options);
+    DynamicTicTacToeState state(DynamicBoard(7, 7, 4));
+    std::atomic<bool>     done(false);
+    std::thread           thread([&player, &state, &done] () {
+        player.move(&state);
+        done = true;
+    });
+    while (!done)
+    {
+        player.cancel();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    thread.join();
+    EXPECT_EQ(state.numberOfMoves(), 1);
+}
+
+TEST(DynamicTicTacToeEvaluator, Evaluate)
+{
+    // The dynamic evaluator computes the same heuristic as the compiled evaluator
+    BasicTicTacToeEvaluator<4, 4, 4> compiled(BasicTicTacToeEvaluator<4, 4, 4>::Mode::HEURISTIC);
+    DynamicTicTacToeEvaluator        dynamic;
+    BasicTicTacToeState<4, 4, 4>     state;
+    DynamicTicTacToeState            dynamicState(DynamicBoard(4, 4, 4));
+    int const                        moves[][2] = { { 1, 1 }, { 3, 1 }, { 2, 2 }, { 1, 3 }, { 0, 0 }, { 3, 3 },
+                                                    { 0, 1 }, { 3, 0 }, { 0, 3 }, { 3, 2 } };
+    EXPECT_EQ(dynamic.evaluate(dynamicState), compiled.evaluate(state));
+    for (auto const & move : moves)
+    {
+        state.move(move[0], move[1]);
+        dynamicState.move(move[0], move[1]);
+        EXPECT_EQ(dynamic.evaluate(dynamicState), compiled.evaluate(state));
+    }
+    EXPECT_EQ(dynamic.evaluate(dynamicState), dynamic.bobWinsValue());
+}
+} // namespace TicTacToe
@@ -0,0 +1,73 @@
+#include "gtest/gtest.h"
+
+#include "ComputerPlayer/SearchStatistics.h"
+
+#include <chrono>
+
+namespace TicTacToe
+{
+TEST(SearchStatistics, Constructor)
+{
+    SearchStatistics statistics;
+    EXPECT_EQ(statistics.nodes, 0u);
+    EXPECT_EQ(statistics.leaves, 0u);
+    EXPECT_EQ(statistics.cutoffs, 0u);
+    for (uint64_t count : statistics.cutoffsByPly)
+    {
+        EXPECT_EQ(count, 0u);
+    }
+    EXPECT_EQ(statistics.probes, 0u);
+    EXPECT_EQ(statistics.elapsed.count(), 0);
+    EXPECT_EQ(statistics.nodesPerSecond(), 0.0);
+    EXPECT_EQ(statistics.hitRate(), 0.0);
+}
+
+TEST(SearchStatistics, Cutoff)
+{
+    SearchStatistics statistics;
+    statistics.cutoff(1);
+    statistics.cutoff(1);
+    statistics.cutoff(SearchStatistics::MAX_PLY + 5);
+    EXPECT_EQ(statistics.cutoffs, 3u);
+    EXPECT_EQ(statistics.cutoffsByPly[1], 2u);
+    EXPECT_EQ(statistics.cutoffsByPly[SearchStatistics::MAX_PLY - 1], 1u);
+}
+
+TEST(SearchStatistics, Rates)
+{
+    SearchStatistics statistics;
+    statistics.nodes   = 1000;
+    statistics.probes  = 4;
+    statistics.hits    = 1;
+    statistics.elapsed = std::chrono::milliseconds(500);
+    EXPECT_DOUBLE_EQ(statistics.nodesPerSecond(), 2000.0);
+    EXPECT_DOUBLE_EQ(statistics.hitRate(), 0.25);
+}
+
+TEST(SearchStatistics, Add)
+{
+    SearchStatistics a;
+    a.nodes      = 10;
+    a.leaves     = 5;
+    a.probes     = 4;
+    a.hits       = 2;
+    a.collisions = 1;
+    a.overwrites = 1;
+    a.elapsed    = std::chrono::milliseconds(1);
+    a.cutoff(2);
+
+    SearchStatistics b = a;
+    b.cutoff(3);
+    b += a;
+    EXPECT_EQ(b.nodes, 20u);
+    EXPECT_EQ(b.leaves, 10u);
+    EXPECT_EQ(b.probes, 8u);
+    EXPECT_EQ(b.hits, 4u);
+    EXPECT_EQ(b.collisions, 2u);
+    EXPECT_EQ(b.overwrites, 2u);
+    EXPECT_EQ(b.cutoffs, 3u);
+    EXPECT_EQ(b.cutoffsByPly[2], 2u);
+    EXPECT_EQ(b.cutoffsByPly[3], 1u);
+    EXPECT_EQ(b.elapsed, std::chrono::milliseconds(2));
+}
+} // namespace TicTacToe
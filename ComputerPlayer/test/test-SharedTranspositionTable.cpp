@@ -0,0 +1,123 @@
+#include "gtest/gtest.h"
+
+#include "ComputerPlayer/SharedTranspositionTable.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace TicTacToe
+{
+using Bound = SharedTranspositionTable::Bound;
+using Entry = SharedTranspositionTable::Entry;
+
+TEST(SharedTranspositionTable, Constructor)
+{
+    EXPECT_EQ(SharedTranspositionTable(1).size(), 4u);
+    EXPECT_EQ(SharedTranspositionTable(100).size(), 128u);
+    EXPECT_EQ(SharedTranspositionTable(128).size(), 128u);
+
+    SharedTranspositionTable table(100);
+    Entry                    entry;
+    for (uint64_t hash = 0; hash < 1000; ++hash)
+    {
+        EXPECT_FALSE(table.probe(hash, &entry));
+    }
+}
+
+TEST(SharedTranspositionTable, Store)
+{
+    SharedTranspositionTable table(100);
+    table.store(12345, { -1.5f, 4, Bound::UPPER, 7, true });
+
+    Entry entry;
+    ASSERT_TRUE(table.probe(12345, &entry));
+    EXPECT_EQ(entry.value, -1.5f);
+    EXPECT_EQ(entry.depth, 4);
+    EXPECT_EQ(entry.bound, Bound::UPPER);
+    EXPECT_EQ(entry.bestMove, 7);
+    EXPECT_TRUE(entry.complete);
+
+    // A hash that selects the same bucket is not confused with it
+    EXPECT_FALSE(table.probe(12345 + table.size(), &entry));
+
+    // A new result for the same state replaces the old one
+    table.store(12345, { 10000.0f, 0, Bound::EXACT, -1, false });
+    ASSERT_TRUE(table.probe(12345, &entry));
+    EXPECT_EQ(entry.value, 10000.0f);
+    EXPECT_EQ(entry.depth, 0);
+    EXPECT_EQ(entry.bound, Bound::EXACT);
+    EXPECT_EQ(entry.bestMove, -1);
+    EXPECT_FALSE(entry.complete);
+}
+
+TEST(SharedTranspositionTable, Store_replacement)
+{
+    // A table with one bucket
+    SharedTranspositionTable table(1);
+    Entry entry;
+    bool  collision;
+    for (int i = 0; i < SharedTranspositionTable::SLOTS_PER_BUCKET; ++i)
+    {
+        EXPECT_FALSE(table.probe(100, &entry, &collision));
+        EXPECT_FALSE(collision);
+        EXPECT_FALSE(table.store(i + 1, { 0.0f, int8_t(i + 1), Bound::EXACT, -1, false }));
+    }
+
+    // Updating an entry does not replace another state's entry
+    EXPECT_FALSE(table.store(1, { 0.0f, 1, Bound::EXACT, -1, false }));
+
+    // A state that is missing from a full bucket is a collision
+    EXPECT_FALSE(table.probe(100, &entry, &collision));
+    EXPECT_TRUE(collision);
+    EXPECT_TRUE(table.probe(1, &entry, &collision));
+    EXPECT_FALSE(collision);
+
+    // When the bucket is full, the entry with the shallowest search is replaced
+    EXPECT_TRUE(table.store(100, { 0.0f, 8, Bound::EXACT, -1, false }));
+    EXPECT_TRUE(table.probe(100, &entry));
+    EXPECT_FALSE(table.probe(1, &entry));
+    for (int i = 2; i <= SharedTranspositionTable::SLOTS_PER_BUCKET; ++i)
+    {
+        EXPECT_TRUE(table.probe(i, &entry));
+    }
+}
+
+TEST(SharedTranspositionTable, Clear)
+{
+    SharedTranspositionTable table(100);
+    table.store(1, { 0.0f, 1, Bound::EXACT, -1, false });
+    table.clear();
+    Entry entry;
+    EXPECT_FALSE(table.probe(1, &entry));
+}
+
+TEST(SharedTranspositionTable, Concurrent)
+{
+    // Many threads store into a small table at once. Every entry that is found must be one that was stored for its hash.
+    SharedTranspositionTable table(64);
+    std::atomic<int>         mismatches(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t)
+    {
+        threads.emplace_back([&table, &mismatches, t] {
+            for (uint64_t i = 0; i < 100000; ++i)
+            {
+                uint64_t hash = (i * 0x9e3779b97f4a7c15ull) ^ uint64_t(t);
+                table.store(hash, { float(hash % 1000), int8_t(hash % 9), Bound::EXACT, int8_t(hash % 9), false });
+
+                Entry    entry;
+                uint64_t other = ((i / 2) * 0x9e3779b97f4a7c15ull) ^ uint64_t((t + 1) % 8);
+                if (table.probe(other, &entry) && (entry.value != float(other % 1000) || entry.depth != int8_t(other % 9)))
+                    ++mismatches;
+            }
+        });
+    }
+    for (std::thread & thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(mismatches, 0);
+}
+} // namespace TicTacToe
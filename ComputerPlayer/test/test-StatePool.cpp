@@ -0,0 +1,78 @@
+#include "gtest/gtest.h"
+
+#include "ComputerPlayer/StatePool.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+namespace TicTacToe
+{
+TEST(StatePool, Constructor)
+{
+    ASSERT_NO_THROW(StatePool(64));
+    ASSERT_NO_THROW(StatePool(1, 1));
+
+    StatePool pool(1, 16);
+    EXPECT_EQ(pool.slotSize() % alignof(std::max_align_t), 0u);
+    EXPECT_GE(pool.slotSize(), sizeof(void *));
+    EXPECT_EQ(pool.slotsInUse(), 0u);
+    EXPECT_EQ(pool.capacity(), 0u);
+}
+
+TEST(StatePool, Allocate)
+{
+    StatePool pool(100, 16);
+
+    // Allocations are distinct, aligned, and the pool grows a chunk at a time
+    std::set<void *> slots;
+    for (int i = 0; i < 40; ++i)
+    {
+        void * p = pool.allocate();
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % alignof(std::max_align_t), 0u);
+        slots.insert(p);
+    }
+    EXPECT_EQ(slots.size(), 40u);
+    EXPECT_EQ(pool.slotsInUse(), 40u);
+    EXPECT_EQ(pool.capacity(), 48u);
+
+    for (void * p : slots)
+    {
+        pool.deallocate(p);
+    }
+    EXPECT_EQ(pool.slotsInUse(), 0u);
+}
+
+TEST(StatePool, Deallocate)
+{
+    StatePool pool(32, 4);
+
+    // Returned slots are reused without growing the pool
+    std::vector<void *> first;
+    for (int i = 0; i < 4; ++i)
+    {
+        first.push_back(pool.allocate());
+    }
+    for (void * p : first)
+    {
+        pool.deallocate(p);
+    }
+    std::set<void *> reused;
+    for (int i = 0; i < 4; ++i)
+    {
+        reused.insert(pool.allocate());
+    }
+    EXPECT_EQ(reused, std::set<void *>(first.begin(), first.end()));
+    EXPECT_EQ(pool.capacity(), 4u);
+
+    // Deallocating nullptr does nothing
+    pool.deallocate(nullptr);
+    EXPECT_EQ(pool.slotsInUse(), 4u);
+
+    for (void * p : reused)
+    {
+        pool.deallocate(p);
+    }
+}
+} // namespace TicTacToe
@@ -0,0 +1,36 @@
+#include "gtest/gtest.h"
+
+#include "ComputerPlayer/StopSignal.h"
+
+namespace TicTacToe
+{
+TEST(StopSignal, Constructor)
+{
+    StopSignal signal;
+    EXPECT_FALSE(signal.requested());
+    EXPECT_FALSE(signal.flag()->load());
+}
+
+TEST(StopSignal, Request)
+{
+    StopSignal signal;
+
+    // A request is ignored unless work is in progress
+    signal.request();
+    EXPECT_FALSE(signal.requested());
+
+    signal.start();
+    EXPECT_FALSE(signal.requested());
+    signal.request();
+    EXPECT_TRUE(signal.requested());
+    EXPECT_TRUE(signal.flag()->load());
+
+    // Finishing the work clears the request, so the next work is not stopped
+    signal.finish();
+    EXPECT_FALSE(signal.requested());
+    signal.request();
+    signal.start();
+    EXPECT_FALSE(signal.requested());
+    signal.finish();
+}
+} // namespace TicTacToe
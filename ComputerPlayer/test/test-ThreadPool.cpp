@@ -0,0 +1,43 @@
+#include "gtest/gtest.h"
+
+#include "ComputerPlayer/ThreadPool.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace TicTacToe
+{
+TEST(ThreadPool, Constructor)
+{
+    EXPECT_EQ(ThreadPool(1).size(), 1);
+    EXPECT_EQ(ThreadPool(4).size(), 4);
+    EXPECT_GE(ThreadPool().size(), 1);
+}
+
+TEST(ThreadPool, Run)
+{
+    ThreadPool pool(4);
+
+    // Every thread runs the task once, with its own index
+    std::vector<int> counts(pool.size(), 0);
+    pool.run([&](int thread) { ++counts[thread]; });
+    EXPECT_EQ(counts, std::vector<int>(pool.size(), 1));
+
+    // The pool can be reused, and run() does not return until the work is done
+    std::atomic<int> next(0);
+    std::atomic<int> sum(0);
+    for (int repeat = 0; repeat < 100; ++repeat)
+    {
+        next = 0;
+        sum  = 0;
+        pool.run([&](int) {
+            for (int i = next++; i < 1000; i = next++)
+            {
+                sum += i;
+            }
+        });
+        ASSERT_EQ(sum, 999 * 1000 / 2);
+    }
+}
+} // namespace TicTacToe
@@ -16,9 +16,16 @@ TEST(TicTacToeEvaluator, Constructor)
     ASSERT_NO_THROW(TicTacToeEvaluator());
 }
 
+TEST(TicTacToeEvaluator, Mode)
+{
+    EXPECT_EQ(TicTacToeEvaluator().mode(), TicTacToeEvaluator::Mode::TABLE);
+    EXPECT_EQ(TicTacToeEvaluator(TicTacToeEvaluator::Mode::HEURISTIC).mode(), TicTacToeEvaluator::Mode::HEURISTIC);
+    EXPECT_EQ(TicTacToeEvaluator(TicTacToeEvaluator::Mode::TABLE).mode(), TicTacToeEvaluator::Mode::TABLE);
+}
+
 TEST(TicTacToeEvaluator, Evaluate)
 {
-    TicTacToeEvaluator evaluator;
+    TicTacToeEvaluator evaluator(TicTacToeEvaluator::Mode::HEURISTIC);
 
     // The starting state should have a score of 0
     {
@@ -114,6 +121,34 @@ TEST(TicTacToeEvaluator, Evaluate)
     }
 }
 
+// Checks that the table and the heuristic agree for every state reachable from the given state
+static void CompareModes(TicTacToeEvaluator const & table, TicTacToeEvaluator const & heuristic, TicTacToeState & state)
+{
+    ASSERT_EQ(table.evaluate(state), heuristic.evaluate(state));
+    TicTacToeState::MoveList moves;
+    state.generateMoves(&moves);
+    for (auto const & move : moves)
+    {
+        state.move(move.row, move.column);
+        CompareModes(table, heuristic, state);
+        state.unmove();
+    }
+}
+
+TEST(TicTacToeEvaluator, Evaluate_table)
+{
+    TicTacToeEvaluator table(TicTacToeEvaluator::Mode::TABLE);
+    TicTacToeEvaluator heuristic(TicTacToeEvaluator::Mode::HEURISTIC);
+    {
+        TicTacToeState state;
+        CompareModes(table, heuristic, state);
+    }
+    {
+        TicTacToeState state(Board(), TicTacToeState::PlayerId::BOB);
+        CompareModes(table, heuristic, state);
+    }
+}
+
 TEST(TicTacToeEvaluator, AliceWins)
 {
     // Alice should have a large positive score (>= 100 * 100) for winning
@@ -125,4 +160,42 @@ TEST(TicTacToeEvaluator, BobWins)
     // The bob (O) should have a large negative score (<= -100 * 100) for winning
     EXPECT_LE(TicTacToeEvaluator().bobWinsValue(), -10000.0f);
 }
+
+TEST(TicTacToeEvaluator, Sizes)
+{
+    {
+        // A 3x4 board has a table, and it matches the heuristic
+        using Evaluator = BasicTicTacToeEvaluator<3, 4, 3>;
+        using State     = Evaluator::State;
+        Evaluator table(Evaluator::Mode::TABLE);
+        Evaluator heuristic(Evaluator::Mode::HEURISTIC);
+        State     state;
+        state.move(1, 1);
+        EXPECT_EQ(table.evaluate(state), heuristic.evaluate(state));
+        EXPECT_EQ(heuristic.evaluate(state), CENTER_BONUS); // (1, 1) is one of the 2 center cells
+        state.move(0, 0);
+        EXPECT_EQ(table.evaluate(state), heuristic.evaluate(state));
+        EXPECT_EQ(heuristic.evaluate(state), CENTER_BONUS - CORNER_BONUS);
+    }
+    {
+        // A 4x4 board has no table, so it always uses the heuristic
+        using Evaluator = BasicTicTacToeEvaluator<4, 4, 4>;
+        using State     = Evaluator::State;
+        EXPECT_EQ(Evaluator(Evaluator::Mode::TABLE).mode(), Evaluator::Mode::HEURISTIC);
+        Evaluator evaluator;
+        State     state;
+        state.move(1, 1); // X
+        state.move(3, 1); // O
+        state.move(2, 2); // X
+        state.move(1, 3); // O
+        state.move(0, 0); // X, with 3 in the diagonal
+        EXPECT_EQ(evaluator.evaluate(state), TWO_IN_LINE_BONUS + 2 * CENTER_BONUS + CORNER_BONUS);
+        state.move(3, 3); // O
+        state.move(0, 1); // X
+        state.move(3, 0); // O
+        state.move(0, 3); // X
+        state.move(3, 2); // O wins
+        EXPECT_EQ(evaluator.evaluate(state), evaluator.bobWinsValue());
+    }
+}
 } // namespace TicTacToe
@@ -0,0 +1,51 @@
+#include "gtest/gtest.h"
+
+#include "ComputerPlayer/Worker.h"
+
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace TicTacToe
+{
+TEST(Worker, Submit)
+{
+    Worker worker;
+
+    // The result of the function is returned through the future
+    std::future<int> result = worker.submit([] { return 42; });
+    EXPECT_EQ(result.get(), 42);
+
+    // The tasks run in order, on the same thread, which is not the caller's
+    std::vector<std::future<std::thread::id>> ids;
+    std::vector<int>                          order;
+    for (int i = 0; i < 10; ++i)
+    {
+        ids.push_back(worker.submit([&order, i] {
+            order.push_back(i);
+            return std::this_thread::get_id();
+        }));
+    }
+    std::thread::id id = ids[0].get();
+    EXPECT_NE(id, std::this_thread::get_id());
+    for (size_t i = 1; i < ids.size(); ++i)
+    {
+        EXPECT_EQ(ids[i].get(), id);
+    }
+    EXPECT_EQ(order, std::vector<int>({ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }));
+}
+
+TEST(Worker, Destructor)
+{
+    // The tasks that have been submitted are finished before the worker is destroyed
+    int count = 0;
+    {
+        Worker worker;
+        for (int i = 0; i < 100; ++i)
+        {
+            worker.submit([&count] { ++count; });
+        }
+    }
+    EXPECT_EQ(count, 100);
+}
+} // namespace TicTacToe
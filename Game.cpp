@@ -1,30 +1,113 @@
 #include "Game.h"
 
 #include "ComputerPlayer/ComputerPlayer.h"
+#include "ComputerPlayer/DynamicTicTacToeEvaluator.h"
+#include "ComputerPlayer/SearchPlayer.h"
+#include "ComputerPlayer/TicTacToeEvaluator.h"
+#include "MctsPlayer/MctsPlayer.h"
+#include "Tablebase/Tablebase.h"
+#include "Tablebase/TablebasePlayer.h"
+#include "TicTacToeState/DynamicTicTacToeState.h"
 #include "TicTacToeState/TicTacToeState.h"
 
+#include <cassert>
+#include <chrono>
 #include <iostream>
+#include <stdexcept>
+#include <thread>
 
-Game::Game(bool humanGoesFirst)
-    : window_()
-    , state_()
+// Returns a 3x3 computer player using the specified engine
+static std::unique_ptr<Player> makeComputer(Game::Engine             engine,
+                                            TicTacToeState::PlayerId playerId,
+                                            std::string const &      tablebase)
+{
+    switch (engine)
+    {
+    case Game::Engine::NEGAMAX:
+    {
+        ComputerPlayer::Options options;
+        options.engine = ComputerPlayer::Options::Engine::NEGAMAX;
+        return std::make_unique<ComputerPlayer>(playerId, options);
+    }
+
+    case Game::Engine::MCTS:
+        return std::make_unique<MctsPlayer>(playerId);
+
+    case Game::Engine::TABLEBASE:
+        return std::make_unique<TablebasePlayer>(playerId, std::make_shared<Tablebase>(tablebase));
+
+    case Game::Engine::MINIMAX:
+        break;
+    }
+    return std::make_unique<ComputerPlayer>(playerId);
+}
+
+// Returns a computer player for a board other than 3x3. MINIMAX and NEGAMAX are played by a SearchPlayer, MCTS by a
+// BasicMctsPlayer, and TABLEBASE by a tablebase player if the board has ranks. Throws std::runtime_error if the engine cannot
+// play the board.
+template <typename State, typename Evaluator>
+static std::unique_ptr<BasicPlayer<State>> makeComputer(Game::Engine             engine,
+                                                        typename State::PlayerId playerId,
+                                                        std::string const &      tablebase)
+{
+    if (engine == Game::Engine::TABLEBASE)
+    {
+        if constexpr (State::Board::HAS_RANKS)
+            return std::make_unique<BasicTablebasePlayer<State>>(playerId, std::make_shared<Tablebase>(tablebase));
+        else
+            throw std::runtime_error("The tablebase engine cannot play a board this big");
+    }
+    if (engine == Game::Engine::MCTS)
+        return std::make_unique<BasicMctsPlayer<State>>(playerId);
+    return std::make_unique<SearchPlayer<State, Evaluator>>(playerId);
+}
+
+// Returns the player that the computer plays
+static GamePlayer::GameState::PlayerId computerId(bool humanGoesFirst)
+{
+    return humanGoesFirst ? GamePlayer::GameState::PlayerId::BOB : GamePlayer::GameState::PlayerId::ALICE;
+}
+
+template <typename State>
+BasicGame<State>::BasicGame(bool humanGoesFirst, Size const & size, State const & initial, std::unique_ptr<Player> computer)
+    : window_(size.rows, size.columns)
+    , initial_(initial)
+    , state_(initial)
+    , computer_(std::move(computer))
+    , computerMove_()
+    , computerPonder_()
     , currentPhase_(Phase::WAITING_FOR_HUMAN)
     , needsRender_(true)
     , computerMoveStartTime_(0)
-    , humanId_(humanGoesFirst ? TicTacToeState::PlayerId::ALICE : TicTacToeState::PlayerId::BOB)
-    , computerId_(humanGoesFirst ? TicTacToeState::PlayerId::BOB : TicTacToeState::PlayerId::ALICE)
+    , humanId_(humanGoesFirst ? PlayerId::ALICE : PlayerId::BOB)
+    , computerId_(humanGoesFirst ? PlayerId::BOB : PlayerId::ALICE)
 {
-
-    computer_ = std::make_unique<ComputerPlayer>(computerId_);
+    assert(computer_->playerId() == computerId_);
 
     // Set initial phase based on who goes first
     if (state_.whoseTurn() == computerId_)
     {
         transition(Phase::WAITING_FOR_COMPUTER);
     }
+    else
+    {
+        startComputerPonder();
+    }
+}
+
+template <typename State>
+BasicGame<State>::~BasicGame()
+{
+    // The worker thread uses this game, so it must finish before the game is destroyed
+    static constexpr std::chrono::milliseconds POLL_INTERVAL(1);
+    while (!stopComputer())
+    {
+        std::this_thread::sleep_for(POLL_INTERVAL);
+    }
 }
 
-SDL_AppResult Game::handleEvent(SDL_Event * event)
+template <typename State>
+SDL_AppResult BasicGame<State>::handleEvent(SDL_Event * event)
 {
     if (event->type == SDL_EVENT_QUIT || (event->type == SDL_EVENT_KEY_DOWN && event->key.key == SDLK_ESCAPE))
     {
@@ -50,7 +133,8 @@ SDL_AppResult Game::handleEvent(SDL_Event * event)
     return SDL_APP_CONTINUE;
 }
 
-SDL_AppResult Game::iterate()
+template <typename State>
+SDL_AppResult BasicGame<State>::iterate()
 {
     if (currentPhase_ == Phase::QUIT)
     {
@@ -73,7 +157,8 @@ SDL_AppResult Game::iterate()
     return SDL_APP_CONTINUE;
 }
 
-void Game::handleMouseClick(int x, int y)
+template <typename State>
+void BasicGame<State>::handleMouseClick(int x, int y)
 {
     if (state_.whoseTurn() != humanId_)
     {
@@ -83,8 +168,11 @@ void Game::handleMouseClick(int x, int y)
     auto [row, col] = window_.screenToBoard(x, y);
 
     // Check if the cell is empty and the move is valid
-    if (state_.board().at(row, col) == Board::Cell::NEITHER)
+    if (state_.board().at(row, col) == BoardCell::NEITHER)
     {
+        // The computer ponders a copy of the state, so the move is shown at once. The computer is asked to stop pondering, and
+        // the game waits for it in update() before the computer moves or the game ends.
+        stopComputer();
         state_.move(row, col);
         needsRender_ = true;
 
@@ -99,40 +187,52 @@ void Game::handleMouseClick(int x, int y)
     }
 }
 
-void Game::update()
+template <typename State>
+void BasicGame<State>::update()
 {
     switch (currentPhase_)
     {
     case Phase::WAITING_FOR_COMPUTER:
-        // Check if enough time has passed for computer to "think"
-        if (SDL_GetTicks() - computerMoveStartTime_ >= COMPUTER_THINK_TIME_MS)
+        // The computer starts its move once it has stopped pondering the human's move
+        if (!computerMove_.valid())
         {
-            if (state_.whoseTurn() == computer_->playerId())
+            if (stopComputer())
+                startComputerMove();
+            break;
+        }
+
+        // The computer's move is shown once it has been found and enough time has passed for the computer to "think"
+        if (computerMove_.valid() && computerMove_.wait_for(std::chrono::seconds(0)) == std::future_status::ready &&
+            SDL_GetTicks() - computerMoveStartTime_ >= COMPUTER_THINK_TIME_MS)
+        {
+            state_       = computerMove_.get();
+            needsRender_ = true;
+
+            if (state_.isDone())
             {
-                computer_->move(&state_);
-                needsRender_ = true;
-
-                if (state_.isDone())
-                {
-                    transition(Phase::GAME_OVER);
-                }
-                else
-                {
-                    transition(Phase::WAITING_FOR_HUMAN);
-                }
+                transition(Phase::GAME_OVER);
+            }
+            else
+            {
+                transition(Phase::WAITING_FOR_HUMAN);
             }
         }
         break;
 
     case Phase::GAME_OVER:
     {
-        auto         winner   = TicTacToeState::toPlayerId(state_.winner()).value_or(TicTacToeState::PlayerId::ALICE);
+        // The next game cannot start until the computer has stopped pondering the last move
+        if (!stopComputer())
+            break;
+
+        auto         winner   = State::toPlayerId(state_.winner()).value_or(PlayerId::ALICE);
         bool         humanWon = (winner == humanId_);
         char const * message  = state_.isDraw() ? "It's a Draw!" : humanWon ? "You Win!" : "Computer Wins!";
         SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_INFORMATION, "Game Over", message, window_.window());
 
         // Reset game
-        state_ = TicTacToeState();
+        state_ = initial_;
+        computer_->reset();
         transition(state_.whoseTurn() == humanId_ ? Phase::WAITING_FOR_HUMAN : Phase::WAITING_FOR_COMPUTER);
         break;
     }
@@ -144,7 +244,8 @@ void Game::update()
     }
 }
 
-void Game::transition(Phase newPhase)
+template <typename State>
+void BasicGame<State>::transition(Phase newPhase)
 {
     if (newPhase == currentPhase_)
     {
@@ -159,15 +260,111 @@ void Game::transition(Phase newPhase)
     {
     case Phase::WAITING_FOR_COMPUTER:
         computerMoveStartTime_ = SDL_GetTicks();
+        if (stopComputer())
+            startComputerMove();
         break;
 
     case Phase::GAME_OVER:
-        break;
-
     case Phase::QUIT:
+        stopComputer();
         break;
 
     case Phase::WAITING_FOR_HUMAN:
+        startComputerPonder();
         break;
     }
 }
+
+template <typename State>
+void BasicGame<State>::startComputerMove()
+{
+    assert(state_.whoseTurn() == computer_->playerId());
+    assert(!computerMove_.valid());
+
+    // The computer searches a copy of the state on the worker thread, so that the window stays responsive while it thinks.
+    // The thread is reused from move to move, so the memory the computer keeps per thread is not allocated again each time.
+    computerMove_ = worker_.submit([this, state = state_]() mutable {
+        computer_->move(&state);
+        return state;
+    });
+}
+
+template <typename State>
+void BasicGame<State>::startComputerPonder()
+{
+    assert(state_.whoseTurn() == humanId_);
+    assert(!computerPonder_.valid());
+
+    // While the human thinks, the computer finds its answer to each possible move on the worker thread
+    computerPonder_ = worker_.submit([this, state = state_]() { computer_->ponder(state); });
+}
+
+template <typename State>
+bool BasicGame<State>::stopComputer()
+{
+    // The worker thread uses the computer player, so its work must be finished before the computer starts anything else. A
+    // request to stop is ignored if the work has not started yet, so the computer is asked again each time until it is done.
+    bool moving    = computerMove_.valid() && computerMove_.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+    bool pondering = computerPonder_.valid() && computerPonder_.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+    if (moving || pondering)
+    {
+        computer_->cancel();
+        return false;
+    }
+
+    computerMove_   = std::future<State>();
+    computerPonder_ = std::future<void>();
+    return true;
+}
+
+// Returns a 3x3 game
+static std::unique_ptr<Game> makeTicTacToeGame(bool humanGoesFirst, Game::Engine engine, std::string const & tablebase)
+{
+    return std::make_unique<BasicGame<TicTacToeState>>(humanGoesFirst,
+                                                       Game::Size(),
+                                                       TicTacToeState(),
+                                                       makeComputer(engine, computerId(humanGoesFirst), tablebase));
+}
+
+// Returns a game of a size with a compiled state
+template <int Rows, int Columns, int K>
+static std::unique_ptr<Game> makeGame(bool humanGoesFirst, Game::Engine engine, std::string const & tablebase)
+{
+    using State     = BasicTicTacToeState<Rows, Columns, K>;
+    using Evaluator = BasicTicTacToeEvaluator<Rows, Columns, K>;
+    return std::make_unique<BasicGame<State>>(humanGoesFirst,
+                                              Game::Size{ Rows, Columns, K },
+                                              State(),
+                                              makeComputer<State, Evaluator>(engine, computerId(humanGoesFirst), tablebase));
+}
+
+// The sizes with compiled states. The 3x3 game is first since it is the default.
+static struct
+{
+    int rows;
+    int columns;
+    int k;
+    std::unique_ptr<Game> (*make)(bool humanGoesFirst, Game::Engine engine, std::string const & tablebase);
+} const KERNELS[] = {
+    { 3, 3, 3, makeTicTacToeGame },
+    { 4, 4, 4, makeGame<4, 4, 4> },
+    { 5, 5, 4, makeGame<5, 5, 4> },
+    { 7, 7, 4, makeGame<7, 7, 4> },
+};
+
+std::unique_ptr<Game> Game::create(bool humanGoesFirst, Size const & size, Engine engine, std::string const & tablebase)
+{
+    for (auto const & kernel : KERNELS)
+    {
+        if (kernel.rows == size.rows && kernel.columns == size.columns && kernel.k == size.k)
+            return kernel.make(humanGoesFirst, engine, tablebase);
+    }
+
+    // Any other size is played on a board whose size is chosen at run time. The board checks the size.
+    DynamicTicTacToeState initial(DynamicBoard(size.rows, size.columns, size.k));
+    return std::make_unique<BasicGame<DynamicTicTacToeState>>(
+        humanGoesFirst,
+        size,
+        initial,
+        makeComputer<DynamicTicTacToeState, DynamicTicTacToeEvaluator>(engine, computerId(humanGoesFirst), tablebase));
+}
@@ -2,24 +2,73 @@
 
 #include "Window.h"
 
-#include "TicTacToeState/TicTacToeState.h"
+#include "Components/Player.h"
+#include "ComputerPlayer/Worker.h"
 
 #include <SDL3/SDL.h>
 
 #include <functional>
+#include <future>
 #include <memory>
+#include <string>
 
-class ComputerPlayer;
-
+// A game between a human and the computer, shown in a window.
+//
+// The game is played on a board of any size, chosen when it is created. Common sizes are played with states compiled for
+// that size (see BasicGame), and any other size with a DynamicTicTacToeState.
 class Game
 {
 public:
-    Game(bool humanGoesFirst);
-    ~Game() = default;
+    // Computer players
+    enum class Engine
+    {
+        MINIMAX,  // ComputerPlayer with GamePlayer::GameTree
+        NEGAMAX,  // ComputerPlayer with NegamaxSearch
+        MCTS,     // MctsPlayer
+        TABLEBASE // TablebasePlayer
+    };
+
+    // Size of the board, and the number of marks in a line needed to win
+    struct Size
+    {
+        int rows    = 3;
+        int columns = 3;
+        int k       = 3;
+    };
+
+    virtual ~Game() = default;
+
+    // Returns a new game of the specified size. Only the 3x3 game can be played by every engine. On other sizes, MINIMAX and
+    // NEGAMAX are both played by a SearchPlayer, MCTS by a BasicMctsPlayer, and TABLEBASE is only available for the compiled
+    // sizes whose boards have ranks. The tablebase is only used by the TABLEBASE engine, and must be for the size of the game.
+    // Throws std::runtime_error if the size or engine is not valid, or if the tablebase cannot be opened or is for another
+    // size.
+    static std::unique_ptr<Game> create(bool                humanGoesFirst,
+                                        Size const &        size,
+                                        Engine              engine    = Engine::MINIMAX,
+                                        std::string const & tablebase = "tictactoe.tb");
 
     // SDL3 main callbacks
-    SDL_AppResult handleEvent(SDL_Event * event);
-    SDL_AppResult iterate();
+    virtual SDL_AppResult handleEvent(SDL_Event * event) = 0;
+    virtual SDL_AppResult iterate()                      = 0;
+};
+
+// A game played with the specified State. The members are defined in Game.cpp, where all of the games are created.
+template <typename State>
+class BasicGame : public Game
+{
+public:
+    using Player   = BasicPlayer<State>;
+    using PlayerId = typename State::PlayerId;
+
+    // Constructor. The game starts from the initial state, whose board is the specified size, and starts again from it after
+    // each game. The computer plays the player that the human does not.
+    BasicGame(bool humanGoesFirst, Size const & size, State const & initial, std::unique_ptr<Player> computer);
+    virtual ~BasicGame();
+
+    // SDL3 main callbacks. Overrides Game::handleEvent() and Game::iterate().
+    virtual SDL_AppResult handleEvent(SDL_Event * event) override;
+    virtual SDL_AppResult iterate() override;
 
 private:
     enum class Phase
@@ -30,18 +79,26 @@ private:
         QUIT
     };
 
-    Window                          window_;
-    TicTacToeState                  state_;
-    std::unique_ptr<ComputerPlayer> computer_;
-    Phase                           currentPhase_;
-    bool                            needsRender_;
-    Uint64                          computerMoveStartTime_; // Timer for computer moves
-    TicTacToeState::PlayerId        humanId_;
-    TicTacToeState::PlayerId        computerId_;
+    Window                  window_;
+    State                   initial_;               // State at the start of each game
+    State                   state_;
+    std::unique_ptr<Player> computer_;
+    Worker                  worker_;                // Thread on which the computer moves and ponders
+    std::future<State>      computerMove_;          // State after the computer's move, found on the worker thread
+    std::future<void>       computerPonder_;        // Computer pondering the human's move on the worker thread
+    Phase                   currentPhase_;
+    bool                    needsRender_;
+    Uint64                  computerMoveStartTime_; // Timer for computer moves
+    PlayerId                humanId_;
+    PlayerId                computerId_;
 
+    // Minimum time before the computer's move is shown, so that it does not appear instantly
     static constexpr Uint64 COMPUTER_THINK_TIME_MS = 500;
 
     void handleMouseClick(int x, int y);
     void update();
     void transition(Phase newPhase);
+    void startComputerMove();
+    void startComputerPonder();
+    bool stopComputer();
 };
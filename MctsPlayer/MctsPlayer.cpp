@@ -0,0 +1,3 @@
+#include "MctsPlayer.h"
+
+template class BasicMctsPlayer<TicTacToeState>;
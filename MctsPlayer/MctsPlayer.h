@@ -0,0 +1,195 @@
+#pragma once
+
+#include "MctsTree.h"
+
+#include "Components/Player.h"
+#include "Components/Tables.h"
+#include "ComputerPlayer/StopSignal.h"
+#include "ComputerPlayer/ThreadPool.h"
+#include "TicTacToeState/TicTacToeState.h"
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// A computer player that chooses its moves with Monte Carlo tree search, for a game played with the specified State.
+// MctsPlayer is the player of the 3x3 game.
+//
+// Instead of evaluating positions, the player plays many random games and chooses the move whose games went best, so it
+// needs no knowledge of the game except its rules, and it plays better the more playouts it is given. Each thread grows its
+// own tree (root parallelization), and the move with the most playouts over all of the trees is chosen. The trees are kept
+// between moves, so the playouts below the moves that were actually played are not wasted.
+//
+// The State must provide what BasicMctsTree requires.
+template <typename State>
+class BasicMctsPlayer : public BasicPlayer<State>
+{
+public:
+    using PlayerId = typename State::PlayerId;
+    using Tree     = BasicMctsTree<State>;
+
+    // Search options
+    struct Options
+    {
+        // Weight of the exploration term of UCT. Higher values try more of the moves that have not done well.
+        float exploration = 1.414f;
+
+        // Number of playouts per move, or 0 for no limit. At least one of the limits must be set.
+        uint64_t playouts = 20000;
+
+        // Time allowed per move, or 0 for no limit
+        std::chrono::milliseconds timeBudget { 0 };
+
+        // Number of threads, each with its own tree, or 0 for one per hardware thread
+        int threads = 1;
+
+        // If true, the trees are kept between moves
+        bool reuseTree = true;
+
+        // Seed for the random playouts. Each thread's seed is derived from it.
+        uint64_t seed = 0;
+    };
+
+    // Constructor
+    explicit BasicMctsPlayer(PlayerId playerId, Options const & options = Options());
+
+    // Gets a move from the computer and applies it to the game state. Overrides BasicPlayer::move().
+    virtual void move(State * pState) override;
+
+    // Grows the trees from the state while the opponent thinks, so that the playouts below the opponent's reply are reused
+    // by the next move. It must be the opponent's turn. This does nothing unless the trees are reused. Overrides
+    // BasicPlayer::ponder().
+    virtual void ponder(State const & state) override;
+
+    // Stops a move or pondering in progress on another thread as soon as possible. A move is still made, but it may not be
+    // the best. Overrides BasicPlayer::cancel().
+    virtual void cancel() override { stop_.request(); }
+
+    // Returns the number of playouts made by all threads for the last move, not including playouts kept from earlier moves
+    uint64_t lastPlayouts() const { return lastPlayouts_; }
+
+private:
+    // Reading the clock is relatively expensive, so it is only checked once per this many playouts
+    static uint64_t constexpr CLOCK_CHECK_INTERVAL = 64;
+
+    // Grows the trees from the state within the budget, and returns the number of playouts made
+    uint64_t search(State const & state);
+
+    Options                            options_;      // Search options
+    ThreadPool                         pool_;         // Threads that grow the trees
+    std::vector<std::unique_ptr<Tree>> trees_;        // A tree for each thread
+    uint64_t                           lastPlayouts_; // Number of playouts made for the last move
+    StopSignal                         stop_;         // Stops the current move or pondering
+};
+
+// The player of the 3x3 game
+using MctsPlayer = BasicMctsPlayer<TicTacToeState>;
+
+template <typename State>
+BasicMctsPlayer<State>::BasicMctsPlayer(PlayerId playerId, Options const & options)
+    : BasicPlayer<State>(playerId)
+    , options_(options)
+    , pool_(options.threads)
+    , lastPlayouts_(0)
+{
+    assert(options_.playouts > 0 || options_.timeBudget.count() > 0);
+
+    // Each tree has its own sequence of random numbers, so the threads do not all play the same games
+    uint64_t seed = options_.seed;
+    for (int i = 0; i < pool_.size(); ++i)
+    {
+        trees_.push_back(std::make_unique<Tree>(options_.exploration, Tables::splitMix64(seed)));
+    }
+}
+
+template <typename State>
+void BasicMctsPlayer<State>::move(State * pState)
+{
+    // Let's be safe and check if the state is valid
+    if (pState == nullptr || pState->isDone())
+    {
+        return;
+    }
+
+    stop_.start();
+    lastPlayouts_ = search(*pState);
+
+    // The move with the most playouts over all of the trees is chosen. If there were no playouts because the move was
+    // cancelled, the first legal move is chosen.
+    std::vector<uint64_t> visits(pState->board().cells(), 0);
+    for (auto const & tree : trees_)
+    {
+        std::vector<uint64_t> treeVisits = tree->rootVisits();
+        assert(treeVisits.size() == visits.size());
+        for (size_t i = 0; i < visits.size(); ++i)
+        {
+            visits[i] += treeVisits[i];
+        }
+    }
+    typename State::MoveList moves;
+    pState->generateMoves(&moves);
+    int      best       = 0;
+    uint64_t bestVisits = 0;
+    for (int i = 0; i < static_cast<int>(moves.size()); ++i)
+    {
+        uint64_t count = visits[pState->board().toIndex(moves[i].row, moves[i].column)];
+        if (count > bestVisits)
+        {
+            best       = i;
+            bestVisits = count;
+        }
+    }
+    stop_.finish();
+
+    pState->move(moves[best].row, moves[best].column);
+}
+
+template <typename State>
+void BasicMctsPlayer<State>::ponder(State const & state)
+{
+    // Let's be safe and check if the state is valid
+    if (!options_.reuseTree || state.isDone() || state.whoseTurn() == this->playerId_)
+    {
+        return;
+    }
+
+    stop_.start();
+    search(state);
+    stop_.finish();
+}
+
+template <typename State>
+uint64_t BasicMctsPlayer<State>::search(State const & state)
+{
+    using Clock = std::chrono::steady_clock;
+
+    bool                  timed    = options_.timeBudget.count() > 0;
+    Clock::time_point     deadline = Clock::now() + options_.timeBudget;
+    uint64_t              threads  = static_cast<uint64_t>(pool_.size());
+    std::atomic<uint64_t> total(0);
+    pool_.run([&](int thread) {
+        Tree & tree = *trees_[thread];
+        if (!options_.reuseTree)
+            tree.clear();
+        tree.setRoot(state);
+
+        // The playouts are divided evenly among the threads
+        uint64_t limit = options_.playouts / threads + ((uint64_t(thread) < options_.playouts % threads) ? 1 : 0);
+        uint64_t count = 0;
+        while ((options_.playouts == 0 || count < limit) && !stop_.requested())
+        {
+            if (timed && count % CLOCK_CHECK_INTERVAL == 0 && Clock::now() >= deadline)
+                break;
+            tree.iterate();
+            ++count;
+        }
+        total += count;
+    });
+    return total;
+}
+
+// The player of the 3x3 game is compiled once, in MctsPlayer.cpp
+extern template class BasicMctsPlayer<TicTacToeState>;
@@ -0,0 +1,3 @@
+#include "MctsTree.h"
+
+template class BasicMctsTree<TicTacToeState>;
@@ -0,0 +1,265 @@
+#pragma once
+
+#include "TicTacToeState/TicTacToeState.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+// A Monte Carlo search tree using UCT (upper confidence bounds applied to trees), for a game played with the specified
+// State. MctsTree is the tree of the 3x3 game.
+//
+// Each iteration follows the most promising moves from the root to a node that has not been expanded, expands it, plays a
+// random game from there, and adds the result to every node on the path. A move is chosen by UCT: its average result plus an
+// exploration term that grows for moves that have been tried less than their siblings. Over many iterations, the most
+// visited move at the root converges on the best move.
+//
+// The nodes are stored in a single vector, and the children of a node are contiguous, so the tree makes no allocations
+// except when the vector grows. A tree is used by one thread at a time.
+//
+// The State must provide generateMoves(), move(), unmove() and playout(), and a board with at(), cells() and toPosition().
+// BasicTicTacToeState and DynamicTicTacToeState both do.
+template <typename State>
+class BasicMctsTree
+{
+public:
+    // Constructor. The exploration constant weights the exploration term of UCT. The seed starts the random number sequence
+    // of the playouts.
+    BasicMctsTree(float exploration, uint64_t seed);
+
+    // Makes the state the root of the tree. If the state follows from the current root and its node is in the tree, the
+    // subtree below it is kept and the rest is discarded. Otherwise, the tree is cleared. Returns true if a subtree was kept.
+    bool setRoot(State const & state);
+
+    // Removes all nodes. The tree has no root until setRoot() is called.
+    void clear();
+
+    // Runs one iteration. The tree must have a root, and the game must not be over.
+    void iterate();
+
+    // Returns the number of playouts through each move at the root, indexed by cell. A cell that is not a legal move has no
+    // playouts. If the tree has never had a root, the list is empty.
+    std::vector<uint64_t> rootVisits() const;
+
+    // Returns the number of playouts through the root
+    uint64_t playouts() const { return nodes_.empty() ? 0 : nodes_[0].visits; }
+
+    // Returns the number of nodes in the tree
+    size_t size() const { return nodes_.size(); }
+
+private:
+    struct Node
+    {
+        uint32_t visits;           // Number of playouts through this node
+        float    score;            // Total result for the player who moved to this node: 1 for a win and 0.5 for a draw
+        int32_t  firstChild;       // Index of the first child, or -1 if the node has not been expanded
+        int16_t  numberOfChildren; // Number of children
+        int16_t  cell;             // Index of the cell of the move to this node, or -1 for the root
+    };
+
+    // Returns true if every mark on the board of the root is also on the board of the state
+    static bool hasMarksOf(State const & state, State const & root);
+
+    // Returns the index of the child of the node chosen by UCT. An unvisited child is always chosen first.
+    int select(int node) const;
+
+    // Adds a child for each legal move in the state, which is the state of the node
+    void expand(int node, State const & state);
+
+    std::vector<Node>        nodes_;       // The nodes. The root is the first node.
+    std::optional<State>     rootState_;   // State of the root
+    std::optional<State>     state_;       // State of the node being visited by an iteration
+    typename State::MoveList moves_;       // Legal moves of the node being expanded
+    std::vector<int>         path_;        // Nodes visited by an iteration
+    float                    exploration_; // Weight of the exploration term of UCT
+    uint64_t                 random_;      // State of the random number sequence of the playouts
+};
+
+// The tree of the 3x3 game
+using MctsTree = BasicMctsTree<TicTacToeState>;
+
+template <typename State>
+BasicMctsTree<State>::BasicMctsTree(float exploration, uint64_t seed)
+    : exploration_(exploration)
+    , random_(seed)
+{
+}
+
+template <typename State>
+bool BasicMctsTree<State>::setRoot(State const & state)
+{
+    // Follow the moves from the current root to the state. Every mark on the board of the root must also be on the board of
+    // the state, and each move must be to a cell that the player has marked on the board of the state.
+    int node = (!nodes_.empty() && hasMarksOf(state, *rootState_)) ? 0 : -1;
+    if (node >= 0)
+    {
+        State current = *rootState_;
+        while (node >= 0 && current.numberOfMoves() < state.numberOfMoves())
+        {
+            BoardCell    mark   = State::toCell(current.whoseTurn());
+            Node const & parent = nodes_[node];
+            int          next   = -1;
+            for (int i = parent.firstChild; i >= 0 && i < parent.firstChild + parent.numberOfChildren; ++i)
+            {
+                if (state.board().at(nodes_[i].cell) == mark)
+                {
+                    next = i;
+                    break;
+                }
+            }
+            node = next;
+            if (node >= 0)
+            {
+                auto [row, column] = current.board().toPosition(nodes_[node].cell);
+                current.move(row, column);
+            }
+        }
+        if (node >= 0 && current.whoseTurn() != state.whoseTurn())
+            node = -1;
+    }
+
+    rootState_ = state;
+    state_     = state;
+    if (node < 0)
+    {
+        nodes_.clear();
+        nodes_.push_back({ 0, 0.0f, -1, 0, -1 });
+        return false;
+    }
+
+    // Copy the subtree to a new vector, breadth first, so that the children of each node are still contiguous
+    std::vector<Node> subtree;
+    subtree.reserve(nodes_.size());
+    subtree.push_back(nodes_[node]);
+    subtree[0].cell = -1;
+    for (size_t i = 0; i < subtree.size(); ++i)
+    {
+        int first = subtree[i].firstChild;
+        if (first >= 0)
+        {
+            subtree[i].firstChild = static_cast<int32_t>(subtree.size());
+            subtree.insert(subtree.end(), nodes_.begin() + first, nodes_.begin() + first + subtree[i].numberOfChildren);
+        }
+    }
+    nodes_.swap(subtree);
+    return true;
+}
+
+template <typename State>
+void BasicMctsTree<State>::clear()
+{
+    nodes_.clear();
+}
+
+template <typename State>
+void BasicMctsTree<State>::iterate()
+{
+    assert(!nodes_.empty());
+    assert(!rootState_->isDone());
+
+    // Follow UCT down the tree, and expand the first node that has not been expanded
+    State & state = *state_;
+    path_.clear();
+    int node = 0;
+    path_.push_back(node);
+    while (!state.isDone())
+    {
+        bool expanded = nodes_[node].firstChild >= 0;
+        if (!expanded)
+            expand(node, state);
+        node               = select(node);
+        auto [row, column] = state.board().toPosition(nodes_[node].cell);
+        state.move(row, column);
+        path_.push_back(node);
+        if (!expanded)
+            break;
+    }
+
+    BoardCell winner = state.playout(&random_);
+
+    // Add the result to the nodes on the path. The player who moved to a node alternates, starting with the player to move
+    // at the root.
+    ++nodes_[path_[0]].visits;
+    BoardCell mover = State::toCell(rootState_->whoseTurn());
+    for (size_t i = 1; i < path_.size(); ++i)
+    {
+        Node & visited = nodes_[path_[i]];
+        ++visited.visits;
+        visited.score += (winner == mover) ? 1.0f : (winner == BoardCell::NEITHER) ? 0.5f : 0.0f;
+        mover = (mover == BoardCell::X) ? BoardCell::O : BoardCell::X;
+        state.unmove();
+    }
+}
+
+template <typename State>
+std::vector<uint64_t> BasicMctsTree<State>::rootVisits() const
+{
+    std::vector<uint64_t> visits(rootState_ ? rootState_->board().cells() : 0, 0);
+    if (!nodes_.empty() && nodes_[0].firstChild >= 0)
+    {
+        Node const & root = nodes_[0];
+        for (int i = root.firstChild; i < root.firstChild + root.numberOfChildren; ++i)
+        {
+            visits[nodes_[i].cell] = nodes_[i].visits;
+        }
+    }
+    return visits;
+}
+
+template <typename State>
+bool BasicMctsTree<State>::hasMarksOf(State const & state, State const & root)
+{
+    if (state.board().cells() != root.board().cells())
+        return false;
+    for (int i = 0; i < root.board().cells(); ++i)
+    {
+        BoardCell mark = root.board().at(i);
+        if (mark != BoardCell::NEITHER && state.board().at(i) != mark)
+            return false;
+    }
+    return true;
+}
+
+template <typename State>
+int BasicMctsTree<State>::select(int node) const
+{
+    Node const & parent    = nodes_[node];
+    float        logVisits = std::log(static_cast<float>(std::max(parent.visits, 1u)));
+    int          best      = -1;
+    float        bestValue = -std::numeric_limits<float>::infinity();
+    for (int i = parent.firstChild; i < parent.firstChild + parent.numberOfChildren; ++i)
+    {
+        Node const & child = nodes_[i];
+        if (child.visits == 0)
+            return i;
+
+        float value = child.score / child.visits + exploration_ * std::sqrt(logVisits / child.visits);
+        if (value > bestValue)
+        {
+            best      = i;
+            bestValue = value;
+        }
+    }
+    assert(best >= 0);
+    return best;
+}
+
+template <typename State>
+void BasicMctsTree<State>::expand(int node, State const & state)
+{
+    int first = static_cast<int>(nodes_.size());
+    state.generateMoves(&moves_);
+    for (auto const & move : moves_)
+    {
+        nodes_.push_back({ 0, 0.0f, -1, 0, static_cast<int16_t>(state.board().toIndex(move.row, move.column)) });
+    }
+    nodes_[node].firstChild       = first;
+    nodes_[node].numberOfChildren = static_cast<int16_t>(nodes_.size() - first);
+}
+
+// The tree of the 3x3 game is compiled once, in MctsTree.cpp
+extern template class BasicMctsTree<TicTacToeState>;
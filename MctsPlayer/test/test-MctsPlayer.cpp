@@ -0,0 +1,153 @@
+#include "gtest/gtest.h"
+
+#include "Components/Board.h"
+#include "ComputerPlayer/ComputerPlayer.h"
+#include "MctsPlayer/MctsPlayer.h"
+#include "TicTacToeState/DynamicTicTacToeState.h"
+#include "TicTacToeState/TicTacToeState.h"
+
+#include <atomic>
+#include <thread>
+
+namespace TicTacToe
+{
+TEST(MctsPlayer, Constructor)
+{
+    // Nothing to test here, just make sure the constructor executes without error
+    ASSERT_NO_THROW(MctsPlayer{TicTacToeState::PlayerId::ALICE});
+    ASSERT_NO_THROW(MctsPlayer{TicTacToeState::PlayerId::BOB});
+}
+
+TEST(MctsPlayer, Move)
+{
+    for (int threads : { 1, 4 })
+    {
+        MctsPlayer::Options options;
+        options.threads = threads;
+        MctsPlayer computerX(TicTacToeState::PlayerId::ALICE, options);
+        MctsPlayer computerO(TicTacToeState::PlayerId::BOB, options);
+
+        // X wins
+        Board board({{
+                        Board::Cell::X,       Board::Cell::X,       Board::Cell::NEITHER,
+                        Board::Cell::O,       Board::Cell::O,       Board::Cell::NEITHER,
+                        Board::Cell::NEITHER, Board::Cell::NEITHER, Board::Cell::NEITHER
+                    }});
+        TicTacToeState winnable(board, TicTacToeState::PlayerId::ALICE);
+        computerX.move(&winnable);
+        EXPECT_EQ(winnable.winner(), Board::Cell::X);
+        EXPECT_EQ(computerX.lastPlayouts(), options.playouts);
+
+        // O blocks X
+        Board blockable({{
+                            Board::Cell::X,       Board::Cell::NEITHER, Board::Cell::NEITHER,
+                            Board::Cell::NEITHER, Board::Cell::X,       Board::Cell::NEITHER,
+                            Board::Cell::O,       Board::Cell::NEITHER, Board::Cell::NEITHER
+                        }});
+        TicTacToeState state(blockable, TicTacToeState::PlayerId::BOB);
+        computerO.move(&state);
+        EXPECT_EQ(state.board().at(2, 2), Board::Cell::O);
+    }
+}
+
+TEST(MctsPlayer, Move_perfectOpponent)
+{
+    // The player never loses to a perfect opponent, whichever side it plays
+    ComputerPlayer::Options perfect;
+    perfect.engine = ComputerPlayer::Options::Engine::NEGAMAX;
+    perfect.maxDepth = 9;
+    for (auto mctsId : { TicTacToeState::PlayerId::ALICE, TicTacToeState::PlayerId::BOB })
+    {
+        auto           negamaxId = (mctsId == TicTacToeState::PlayerId::ALICE) ? TicTacToeState::PlayerId::BOB :
+                                                                               TicTacToeState::PlayerId::ALICE;
+        MctsPlayer     mcts(mctsId);
+        ComputerPlayer negamax(negamaxId, perfect);
+        TicTacToeState state;
+        while (!state.isDone())
+        {
+            if (state.whoseTurn() == mctsId)
+                mcts.move(&state);
+            else
+                negamax.move(&state);
+        }
+        EXPECT_TRUE(state.isDraw());
+    }
+}
+
+TEST(MctsPlayer, Ponder)
+{
+    MctsPlayer::Options options;
+    options.playouts = 4000;
+    MctsPlayer computerO(TicTacToeState::PlayerId::BOB, options);
+
+    // Pondering grows the tree, so the playouts below the reply are already done when the move is made
+    TicTacToeState state;
+    computerO.ponder(state);
+    state.move(1, 1);
+    computerO.move(&state);
+    EXPECT_EQ(computerO.lastPlayouts(), options.playouts);
+    EXPECT_EQ(state.numberOfMoves(), 2);
+
+    // Pondering is ignored when it is the player's own turn
+    TicTacToeState own;
+    own.move(0, 0);
+    computerO.ponder(own);
+    EXPECT_EQ(computerO.lastPlayouts(), options.playouts);
+}
+
+TEST(MctsPlayer, Cancel)
+{
+    // A move with no limit but time is cancelled from another thread, and a move is still made
+    MctsPlayer::Options options;
+    options.playouts   = 0;
+    options.timeBudget = std::chrono::milliseconds(60000);
+    MctsPlayer        computerX(TicTacToeState::PlayerId::ALICE, options);
+    TicTacToeState    state;
+    std::atomic<bool> done(false);
+    std::thread       worker([&]() {
+        computerX.move(&state);
+        done = true;
+    });
+    while (!done)
+    {
+        computerX.cancel();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    worker.join();
+    EXPECT_EQ(state.numberOfMoves(), 1);
+}
+TEST(MctsPlayer, Sizes)
+{
+    {
+        // On a 4x4 board, X wins with the last cell of the top row
+        using State = BasicTicTacToeState<4, 4, 4>;
+        State::Board board;
+        for (int c = 0; c < 3; ++c)
+        {
+            board.set(0, c, BoardCell::X);
+            board.set(1, c, BoardCell::O);
+        }
+        State                  state(board, State::PlayerId::ALICE);
+        BasicMctsPlayer<State> computerX(State::PlayerId::ALICE);
+        computerX.move(&state);
+        EXPECT_EQ(state.winner(), BoardCell::X);
+    }
+    {
+        // On a board sized at run time, with two threads, O blocks a line of 4
+        DynamicBoard board(5, 6, 4);
+        for (int r = 0; r < 3; ++r)
+        {
+            board.set(r, 5, BoardCell::X);
+        }
+        board.set(0, 0, BoardCell::O);
+        board.set(2, 2, BoardCell::O);
+        BasicMctsPlayer<DynamicTicTacToeState>::Options options;
+        options.threads = 2;
+        DynamicTicTacToeState                  state(board, DynamicTicTacToeState::PlayerId::BOB);
+        BasicMctsPlayer<DynamicTicTacToeState> computerO(DynamicTicTacToeState::PlayerId::BOB, options);
+        computerO.move(&state);
+        EXPECT_EQ(computerO.lastPlayouts(), options.playouts);
+        EXPECT_EQ(state.board().at(3, 5), BoardCell::O);
+    }
+}
+} // namespace TicTacToe
@@ -0,0 +1,175 @@
+#include "gtest/gtest.h"
+
+#include "Components/Board.h"
+#include "MctsPlayer/MctsTree.h"
+#include "TicTacToeState/DynamicTicTacToeState.h"
+#include "TicTacToeState/TicTacToeState.h"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace TicTacToe
+{
+// Returns the cell with the most playouts at the root
+template <typename State>
+static int MostVisited(BasicMctsTree<State> const & tree)
+{
+    std::vector<uint64_t> visits = tree.rootVisits();
+    return static_cast<int>(std::max_element(visits.begin(), visits.end()) - visits.begin());
+}
+
+TEST(MctsTree, Constructor)
+{
+    MctsTree tree(1.414f, 0);
+    EXPECT_EQ(tree.size(), 0u);
+    EXPECT_EQ(tree.playouts(), 0u);
+    EXPECT_TRUE(tree.rootVisits().empty());
+
+    TicTacToeState state;
+    EXPECT_FALSE(tree.setRoot(state));
+    EXPECT_EQ(tree.size(), 1u);
+    EXPECT_EQ(tree.playouts(), 0u);
+    EXPECT_EQ(tree.rootVisits(), std::vector<uint64_t>(9, 0));
+}
+
+TEST(MctsTree, Iterate)
+{
+    MctsTree       tree(1.414f, 0);
+    TicTacToeState state;
+    tree.setRoot(state);
+    for (int i = 0; i < 1000; ++i)
+    {
+        tree.iterate();
+    }
+
+    // Every playout goes through one of the moves at the root, and each iteration adds at most one node per legal move
+    std::vector<uint64_t> visits = tree.rootVisits();
+    EXPECT_EQ(tree.playouts(), 1000u);
+    EXPECT_EQ(std::accumulate(visits.begin(), visits.end(), uint64_t(0)), 1000u);
+    EXPECT_LE(tree.size(), 1u + 9u * 1000u);
+    for (uint64_t count : visits)
+    {
+        EXPECT_GT(count, 0u);
+    }
+
+    // The same seed plays the same games
+    MctsTree same(1.414f, 0);
+    same.setRoot(state);
+    for (int i = 0; i < 1000; ++i)
+    {
+        same.iterate();
+    }
+    EXPECT_EQ(same.rootVisits(), visits);
+    EXPECT_EQ(same.size(), tree.size());
+}
+
+TEST(MctsTree, Iterate_win)
+{
+    // X wins with the top right corner, and O blocks it
+    Board board({{
+                    Board::Cell::X,       Board::Cell::X,       Board::Cell::NEITHER,
+                    Board::Cell::O,       Board::Cell::O,       Board::Cell::NEITHER,
+                    Board::Cell::NEITHER, Board::Cell::NEITHER, Board::Cell::NEITHER
+                }});
+    for (auto player : { TicTacToeState::PlayerId::ALICE, TicTacToeState::PlayerId::BOB })
+    {
+        MctsTree       tree(1.414f, 0);
+        TicTacToeState state(board, player);
+        tree.setRoot(state);
+        for (int i = 0; i < 2000; ++i)
+        {
+            tree.iterate();
+        }
+        EXPECT_EQ(MostVisited(tree), (player == TicTacToeState::PlayerId::ALICE) ? 2 : 5);
+    }
+}
+
+TEST(MctsTree, SetRoot)
+{
+    MctsTree       tree(1.414f, 0);
+    TicTacToeState state;
+    tree.setRoot(state);
+    for (int i = 0; i < 2000; ++i)
+    {
+        tree.iterate();
+    }
+    uint64_t centerPlayouts = tree.rootVisits()[4];
+
+    // The same state keeps the whole tree
+    size_t size = tree.size();
+    EXPECT_TRUE(tree.setRoot(state));
+    EXPECT_EQ(tree.size(), size);
+    EXPECT_EQ(tree.playouts(), 2000u);
+
+    // A state that follows from the root keeps the subtree below it
+    state.move(1, 1);
+    EXPECT_TRUE(tree.setRoot(state));
+    EXPECT_EQ(tree.playouts(), centerPlayouts);
+    EXPECT_LT(tree.size(), size);
+
+    state.move(0, 0);
+    uint64_t cornerPlayouts = tree.rootVisits()[0];
+    EXPECT_GT(cornerPlayouts, 0u);
+    EXPECT_TRUE(tree.setRoot(state));
+    EXPECT_EQ(tree.playouts(), cornerPlayouts);
+
+    // A state that does not follow from the root starts a new tree
+    TicTacToeState other;
+    other.move(0, 2);
+    EXPECT_FALSE(tree.setRoot(other));
+    EXPECT_EQ(tree.size(), 1u);
+    EXPECT_EQ(tree.playouts(), 0u);
+
+    tree.clear();
+    EXPECT_EQ(tree.size(), 0u);
+    EXPECT_FALSE(tree.setRoot(other));
+}
+TEST(MctsTree, Sizes)
+{
+    {
+        // On a 4x4 board, X wins with the last cell of the top row
+        using State = BasicTicTacToeState<4, 4, 4>;
+        State::Board board;
+        for (int c = 0; c < 3; ++c)
+        {
+            board.set(0, c, BoardCell::X);
+            board.set(1, c, BoardCell::O);
+        }
+        BasicMctsTree<State> tree(1.414f, 0);
+        tree.setRoot(State(board, State::PlayerId::ALICE));
+        for (int i = 0; i < 2000; ++i)
+        {
+            tree.iterate();
+        }
+        EXPECT_EQ(tree.rootVisits().size(), 16u);
+        EXPECT_EQ(MostVisited(tree), 3);
+    }
+    {
+        // On a board sized at run time, O blocks the same line, and the subtree below a move is kept
+        DynamicBoard board(4, 5, 4);
+        for (int c = 0; c < 3; ++c)
+        {
+            board.set(0, c, BoardCell::X);
+        }
+        board.set(3, 4, BoardCell::X);
+        board.set(1, 0, BoardCell::O);
+        board.set(1, 4, BoardCell::O);
+        board.set(3, 1, BoardCell::O);
+        DynamicTicTacToeState                state(board, DynamicTicTacToeState::PlayerId::BOB);
+        BasicMctsTree<DynamicTicTacToeState> tree(1.414f, 0);
+        tree.setRoot(state);
+        for (int i = 0; i < 4000; ++i)
+        {
+            tree.iterate();
+        }
+        EXPECT_EQ(tree.rootVisits().size(), 20u);
+        EXPECT_EQ(MostVisited(tree), 3);
+
+        uint64_t blockPlayouts = tree.rootVisits()[3];
+        state.move(0, 3);
+        EXPECT_TRUE(tree.setRoot(state));
+        EXPECT_EQ(tree.playouts(), blockPlayouts);
+    }
+}
+} // namespace TicTacToe
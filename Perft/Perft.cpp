@@ -0,0 +1,111 @@
+#include "Perft.h"
+
+#include "ComputerPlayer/ThreadPool.h"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace Perft
+{
+// The subtrees at this many plies below the start are the units of work shared by the threads. At 3 plies there are 504
+// of them from the empty board, which is enough to keep the threads evenly loaded.
+static int const SPLIT_DEPTH = 3;
+
+Counts & Counts::operator +=(Counts const & rhs)
+{
+    nodes += rhs.nodes;
+    games += rhs.games;
+    xWins += rhs.xWins;
+    oWins += rhs.oWins;
+    draws += rhs.draws;
+    for (int i = 0; i <= MAX_DEPTH; ++i)
+    {
+        byDepth[i] += rhs.byDepth[i];
+    }
+    return *this;
+}
+
+// Adds the counts of the tree below the state, which is the specified number of plies below the start
+static void enumerate(TicTacToeState & state, int depth, Counts * pCounts)
+{
+    ++pCounts->nodes;
+    if (state.isDone())
+    {
+        ++pCounts->games;
+        ++pCounts->byDepth[depth];
+        switch (state.winner())
+        {
+        case Board::Cell::X:
+            ++pCounts->xWins;
+            break;
+        case Board::Cell::O:
+            ++pCounts->oWins;
+            break;
+        default:
+            ++pCounts->draws;
+            break;
+        }
+        return;
+    }
+
+    TicTacToeState::MoveList moves;
+    state.generateMoves(&moves);
+    for (TicTacToeState::Move const & move : moves)
+    {
+        state.move(move.row, move.column);
+        enumerate(state, depth + 1, pCounts);
+        state.unmove();
+    }
+}
+
+// Adds the states above the split depth to the counts and collects the states at the split depth, which are the roots of
+// the subtrees to be enumerated by the threads
+static void split(TicTacToeState & state, int depth, Counts * pCounts, std::vector<std::pair<TicTacToeState, int>> * pWork)
+{
+    if (depth == SPLIT_DEPTH || state.isDone())
+    {
+        pWork->emplace_back(state, depth);
+        return;
+    }
+
+    ++pCounts->nodes;
+    TicTacToeState::MoveList moves;
+    state.generateMoves(&moves);
+    for (TicTacToeState::Move const & move : moves)
+    {
+        state.move(move.row, move.column);
+        split(state, depth + 1, pCounts, pWork);
+        state.unmove();
+    }
+}
+
+Counts run(TicTacToeState const & start, int threads)
+{
+    Counts         counts;
+    TicTacToeState state(start);
+    if (threads == 1)
+    {
+        enumerate(state, 0, &counts);
+        return counts;
+    }
+
+    std::vector<std::pair<TicTacToeState, int>> work;
+    split(state, 0, &counts, &work);
+
+    // Each thread claims subtrees until there are none left, so a thread that finishes early takes on more of the work
+    ThreadPool       pool(threads);
+    std::atomic<int> next(0);
+    std::mutex       mutex;
+    pool.run([&](int) {
+        Counts local;
+        for (size_t i = next++; i < work.size(); i = next++)
+        {
+            enumerate(work[i].first, work[i].second, &local);
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        counts += local;
+    });
+    return counts;
+}
+} // namespace Perft
@@ -0,0 +1,100 @@
+#include "Perft.h"
+
+#include "Components/Board.h"
+#include "TicTacToeState/TicTacToeState.h"
+
+#include <CLI/CLI.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <optional>
+#include <string>
+
+// Returns the state described by a position string, or nothing if the string is invalid. A position string is the 9 cells
+// in row-major order, each 'X', 'O' or '.', and the player to move is determined by the number of Xs and Os.
+static std::optional<TicTacToeState> parsePosition(std::string const & position)
+{
+    if (position.size() != 9)
+        return std::nullopt;
+
+    std::array<Board::Cell, 9> cells;
+    int                        xs = 0;
+    int                        os = 0;
+    for (int i = 0; i < 9; ++i)
+    {
+        switch (position[i])
+        {
+        case 'X':
+        case 'x':
+            cells[i] = Board::Cell::X;
+            ++xs;
+            break;
+        case 'O':
+        case 'o':
+            cells[i] = Board::Cell::O;
+            ++os;
+            break;
+        case '.':
+        case '-':
+            cells[i] = Board::Cell::NEITHER;
+            break;
+        default:
+            return std::nullopt;
+        }
+    }
+    if (xs != os && xs != os + 1)
+        return std::nullopt;
+
+    return TicTacToeState(Board(cells), (xs == os) ? TicTacToeState::PlayerId::ALICE : TicTacToeState::PlayerId::BOB);
+}
+
+int main(int argc, char * argv[])
+{
+    CLI::App cli("Enumerates the complete game tree below a tic-tac-toe position.");
+
+    std::string position = ".........";
+    int         threads  = 1;
+    int         repeat   = 1;
+    cli.add_option("--position, -p", position, "The starting position: 9 cells in row-major order, each X, O or '.'")
+        ->capture_default_str();
+    cli.add_option("--threads, -t", threads, "Number of threads, or 0 for one per hardware thread")
+        ->capture_default_str()
+        ->check(CLI::NonNegativeNumber);
+    cli.add_option("--repeat, -r", repeat, "Number of times to enumerate the tree, for timing")
+        ->capture_default_str()
+        ->check(CLI::PositiveNumber);
+
+    CLI11_PARSE(cli, argc, argv);
+
+    std::optional<TicTacToeState> start = parsePosition(position);
+    if (!start)
+    {
+        std::cerr << "Invalid position: " << position << std::endl;
+        return 1;
+    }
+
+    Perft::Counts counts;
+    auto          begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeat; ++i)
+    {
+        counts = Perft::run(*start, threads);
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+
+    std::printf("depth        games\n");
+    for (int depth = 0; depth <= Perft::MAX_DEPTH; ++depth)
+    {
+        if (counts.byDepth[depth] > 0)
+            std::printf("%5d %12llu\n", depth, static_cast<unsigned long long>(counts.byDepth[depth]));
+    }
+    std::printf("\n");
+    std::printf("nodes:  %llu\n", static_cast<unsigned long long>(counts.nodes));
+    std::printf("games:  %llu\n", static_cast<unsigned long long>(counts.games));
+    std::printf("X wins: %llu\n", static_cast<unsigned long long>(counts.xWins));
+    std::printf("O wins: %llu\n", static_cast<unsigned long long>(counts.oWins));
+    std::printf("draws:  %llu\n", static_cast<unsigned long long>(counts.draws));
+    std::printf("time:   %.3f s\n", elapsed.count());
+    std::printf("nodes/s: %.0f\n", static_cast<double>(counts.nodes) * repeat / elapsed.count());
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include "gtest/gtest.h"
+
+#include "Components/Board.h"
+#include "Perft/Perft.h"
+#include "TicTacToeState/TicTacToeState.h"
+
+namespace TicTacToe
+{
+// Checks the counts for the complete game tree from the empty board
+static void ExpectEmptyBoardCounts(Perft::Counts const & counts)
+{
+    EXPECT_EQ(counts.nodes, 549946u);
+    EXPECT_EQ(counts.games, 255168u);
+    EXPECT_EQ(counts.xWins, 131184u);
+    EXPECT_EQ(counts.oWins, 77904u);
+    EXPECT_EQ(counts.draws, 46080u);
+
+    std::array<uint64_t, Perft::MAX_DEPTH + 1> expected = { 0, 0, 0, 0, 0, 1440, 5328, 47952, 72576, 127872 };
+    EXPECT_EQ(counts.byDepth, expected);
+}
+
+TEST(Perft, Run)
+{
+    ExpectEmptyBoardCounts(Perft::run(TicTacToeState()));
+}
+
+TEST(Perft, Run_threads)
+{
+    ExpectEmptyBoardCounts(Perft::run(TicTacToeState(), 4));
+    ExpectEmptyBoardCounts(Perft::run(TicTacToeState(), 0));
+}
+
+TEST(Perft, Run_position)
+{
+    // X has won, so the position is the only game
+    {
+        Board board({{
+                        Board::Cell::X,       Board::Cell::X,       Board::Cell::X,
+                        Board::Cell::O,       Board::Cell::O,       Board::Cell::NEITHER,
+                        Board::Cell::NEITHER, Board::Cell::NEITHER, Board::Cell::NEITHER
+                    }});
+        TicTacToeState state(board, TicTacToeState::PlayerId::BOB);
+        for (int threads : { 1, 2 })
+        {
+            Perft::Counts counts = Perft::run(state, threads);
+            EXPECT_EQ(counts.nodes, 1u);
+            EXPECT_EQ(counts.games, 1u);
+            EXPECT_EQ(counts.xWins, 1u);
+            EXPECT_EQ(counts.byDepth[0], 1u);
+        }
+    }
+
+    // After X takes the center, the counts are the same with any number of threads
+    {
+        TicTacToeState state;
+        state.move(1, 1);
+        Perft::Counts serial   = Perft::run(state, 1);
+        Perft::Counts parallel = Perft::run(state, 3);
+        EXPECT_EQ(serial.nodes, parallel.nodes);
+        EXPECT_EQ(serial.games, parallel.games);
+        EXPECT_EQ(serial.xWins, parallel.xWins);
+        EXPECT_EQ(serial.oWins, parallel.oWins);
+        EXPECT_EQ(serial.draws, parallel.draws);
+        EXPECT_EQ(serial.byDepth, parallel.byDepth);
+        EXPECT_EQ(serial.games, serial.xWins + serial.oWins + serial.draws);
+    }
+}
+
+TEST(Perft, Counts)
+{
+    Perft::Counts a;
+    a.nodes      = 1;
+    a.games      = 2;
+    a.xWins      = 3;
+    a.oWins      = 4;
+    a.draws      = 5;
+    a.byDepth[9] = 6;
+    Perft::Counts b = a;
+    b += a;
+    EXPECT_EQ(b.nodes, 2u);
+    EXPECT_EQ(b.games, 4u);
+    EXPECT_EQ(b.xWins, 6u);
+    EXPECT_EQ(b.oWins, 8u);
+    EXPECT_EQ(b.draws, 10u);
+    EXPECT_EQ(b.byDepth[9], 12u);
+}
+} // namespace TicTacToe
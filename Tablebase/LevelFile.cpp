@@ -0,0 +1,195 @@
+#include "LevelFile.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <filesystem>
+#include <stdexcept>
+
+// Appends a value as a LEB128 varint: 7 bits per byte, low bits first, with the high bit set on all but the last byte
+static void putVarint(uint64_t value, std::vector<uint8_t> * pBuffer)
+{
+    while (value >= 0x80)
+    {
+        pBuffer->push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    pBuffer->push_back(static_cast<uint8_t>(value));
+}
+
+// Reads a LEB128 varint. Returns false if it runs past the end of the buffer or is too long.
+static bool getVarint(uint8_t const ** p, uint8_t const * end, uint64_t * pValue)
+{
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        if (*p == end)
+            return false;
+        uint8_t byte = *(*p)++;
+        value |= uint64_t(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            *pValue = value;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Returns the temporary name of a file being written
+static std::string temporaryPath(std::string const & path)
+{
+    return path + ".tmp";
+}
+
+LevelWriter::LevelWriter(std::string const & path, bool solved, size_t chunkSize)
+    : path_(path)
+    , file_(temporaryPath(path), std::ios::binary | std::ios::trunc)
+    , solved_(solved)
+    , chunkSize_(chunkSize)
+    , count_(0)
+    , finished_(false)
+{
+    assert(chunkSize_ > 0);
+    if (!file_)
+        throw std::runtime_error("Cannot create " + temporaryPath(path_));
+    keys_.reserve(chunkSize_);
+}
+
+LevelWriter::~LevelWriter()
+{
+    if (!finished_)
+    {
+        file_.close();
+        std::remove(temporaryPath(path_).c_str());
+    }
+}
+
+void LevelWriter::add(uint64_t key)
+{
+    assert(!solved_);
+    assert(!finished_);
+    assert(keys_.empty() || key > keys_.back());
+    keys_.push_back(key);
+    if (keys_.size() == chunkSize_)
+        writeChunk();
+}
+
+void LevelWriter::add(uint64_t key, Tablebase::Entry const & entry)
+{
+    assert(solved_);
+    assert(!finished_);
+    assert(keys_.empty() || key > keys_.back());
+    keys_.push_back(key);
+    entries_.push_back(entry);
+    if (keys_.size() == chunkSize_)
+        writeChunk();
+}
+
+uint64_t LevelWriter::finish()
+{
+    assert(!finished_);
+    if (!keys_.empty())
+        writeChunk();
+    file_.close();
+    if (!file_)
+        throw std::runtime_error("Cannot write " + temporaryPath(path_));
+    std::filesystem::rename(temporaryPath(path_), path_);
+    finished_ = true;
+    return count_;
+}
+
+void LevelWriter::writeChunk()
+{
+    buffer_.clear();
+    uint64_t previous = 0;
+    for (uint64_t key : keys_)
+    {
+        putVarint(key - previous, &buffer_);
+        previous = key;
+    }
+
+    uint32_t header[2] = { static_cast<uint32_t>(keys_.size()), static_cast<uint32_t>(buffer_.size()) };
+    file_.write(reinterpret_cast<char const *>(header), sizeof(header));
+    file_.write(reinterpret_cast<char const *>(buffer_.data()), buffer_.size());
+    if (solved_)
+        file_.write(reinterpret_cast<char const *>(entries_.data()), entries_.size() * sizeof(Tablebase::Entry));
+    if (!file_)
+        throw std::runtime_error("Cannot write " + temporaryPath(path_));
+
+    count_ += keys_.size();
+    keys_.clear();
+    entries_.clear();
+}
+
+LevelReader::LevelReader(std::string const & path, bool solved)
+    : path_(path)
+    , file_(path, std::ios::binary)
+    , solved_(solved)
+    , next_(0)
+{
+    if (!file_)
+        throw std::runtime_error("Cannot open " + path_);
+}
+
+bool LevelReader::next(uint64_t * pKey, Tablebase::Entry * pEntry)
+{
+    if (next_ == keys_.size() && !readChunk())
+        return false;
+    *pKey = keys_[next_];
+    if (solved_ && pEntry)
+        *pEntry = entries_[next_];
+    ++next_;
+    return true;
+}
+
+size_t LevelReader::read(size_t maxCount, std::vector<uint64_t> * pKeys, std::vector<Tablebase::Entry> * pEntries)
+{
+    size_t count = 0;
+    while (count < maxCount && (next_ < keys_.size() || readChunk()))
+    {
+        size_t n = std::min(maxCount - count, keys_.size() - next_);
+        pKeys->insert(pKeys->end(), keys_.begin() + next_, keys_.begin() + next_ + n);
+        if (solved_ && pEntries)
+            pEntries->insert(pEntries->end(), entries_.begin() + next_, entries_.begin() + next_ + n);
+        next_ += n;
+        count += n;
+    }
+    return count;
+}
+
+bool LevelReader::readChunk()
+{
+    uint32_t header[2];
+    if (!file_.read(reinterpret_cast<char *>(header), sizeof(header)))
+    {
+        if (file_.gcount() != 0)
+            throw std::runtime_error("Level file " + path_ + " is truncated");
+        return false;
+    }
+
+    buffer_.resize(header[1]);
+    keys_.resize(header[0]);
+    if (!file_.read(reinterpret_cast<char *>(buffer_.data()), buffer_.size()))
+        throw std::runtime_error("Level file " + path_ + " is truncated");
+    if (solved_)
+    {
+        entries_.resize(header[0]);
+        if (!file_.read(reinterpret_cast<char *>(entries_.data()), entries_.size() * sizeof(Tablebase::Entry)))
+            throw std::runtime_error("Level file " + path_ + " is truncated");
+    }
+
+    uint8_t const * p        = buffer_.data();
+    uint8_t const * end      = p + buffer_.size();
+    uint64_t        previous = 0;
+    for (uint64_t & key : keys_)
+    {
+        uint64_t delta;
+        if (!getVarint(&p, end, &delta))
+            throw std::runtime_error("Level file " + path_ + " is corrupt");
+        key      = previous + delta;
+        previous = key;
+    }
+    next_ = 0;
+    return !keys_.empty() || readChunk();
+}
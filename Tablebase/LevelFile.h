@@ -0,0 +1,85 @@
+#pragma once
+
+#include "Tablebase.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Files of the states at one level (number of marks) of a game, used by MnkSolver to keep the levels on disk.
+//
+// A level file holds keys in increasing order and, if the level is solved, an entry for each key. It is a sequence of
+// chunks, each of which is:
+//
+//   count - 32-bit number of keys in the chunk
+//   size  - 32-bit number of bytes of compressed keys
+//   keys  - the first key, then the difference from each key to the next, as LEB128 varints
+//   entries - solved levels only: count 4-byte entries (see Tablebase::Entry)
+//
+// Consecutive keys are close together, so a key usually takes a byte or two instead of eight. A file is written to a
+// temporary name and renamed when it is finished, so a file with the final name is always complete.
+
+// Writes a level file
+class LevelWriter
+{
+public:
+    // Constructor. Throws std::runtime_error if the file cannot be created.
+    LevelWriter(std::string const & path, bool solved, size_t chunkSize = 4096);
+
+    // Destructor. If the file was not finished, it is removed.
+    ~LevelWriter();
+
+    LevelWriter(LevelWriter const &)              = delete;
+    LevelWriter & operator =(LevelWriter const &) = delete;
+
+    // Adds a key to an unsolved level. Each key must be greater than the last.
+    void add(uint64_t key);
+
+    // Adds a key and its entry to a solved level. Each key must be greater than the last.
+    void add(uint64_t key, Tablebase::Entry const & entry);
+
+    // Writes the rest of the file and gives it its final name. Returns the number of keys. Throws std::runtime_error if the
+    // file cannot be written.
+    uint64_t finish();
+
+private:
+    void writeChunk();
+
+    std::string                   path_;      // Final name of the file
+    std::ofstream                 file_;      // The file, under a temporary name
+    bool                          solved_;    // True if the level has entries
+    size_t                        chunkSize_; // Number of keys per chunk
+    std::vector<uint64_t>         keys_;      // Keys of the current chunk
+    std::vector<Tablebase::Entry> entries_;   // Entries of the current chunk
+    std::vector<uint8_t>          buffer_;    // Compressed keys of the current chunk
+    uint64_t                      count_;     // Number of keys written
+    bool                          finished_;  // True if finish() has been called
+};
+
+// Reads a level file
+class LevelReader
+{
+public:
+    // Constructor. Throws std::runtime_error if the file cannot be opened.
+    LevelReader(std::string const & path, bool solved);
+
+    // Reads the next key, and its entry if the level is solved and pEntry is not nullptr. Returns false if there are no more
+    // keys. Throws std::runtime_error if the file is corrupt.
+    bool next(uint64_t * pKey, Tablebase::Entry * pEntry = nullptr);
+
+    // Appends up to maxCount keys, and their entries if pEntries is not nullptr. Returns the number of keys read.
+    size_t read(size_t maxCount, std::vector<uint64_t> * pKeys, std::vector<Tablebase::Entry> * pEntries = nullptr);
+
+private:
+    bool readChunk();
+
+    std::string                   path_;    // Name of the file, for errors
+    std::ifstream                 file_;    // The file
+    bool                          solved_;  // True if the level has entries
+    std::vector<uint64_t>         keys_;    // Keys of the current chunk
+    std::vector<Tablebase::Entry> entries_; // Entries of the current chunk
+    std::vector<uint8_t>          buffer_;  // Compressed keys of the current chunk
+    size_t                        next_;    // Index of the next key in the current chunk
+};
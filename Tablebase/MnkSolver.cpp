@@ -0,0 +1,484 @@
+#include "MnkSolver.h"
+
+#include "LevelFile.h"
+#include "Retrograde.h"
+
+#include "Components/Bits.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+// Number of states claimed at a time by a thread
+static size_t const SLICE_SIZE = 256;
+
+// Runs a task on every thread of the pool, and rethrows the first exception thrown by any of them
+static void runAll(ThreadPool & pool, std::function<void(int)> const & task)
+{
+    std::exception_ptr error;
+    std::mutex         errorMutex;
+    pool.run([&](int thread) {
+        try
+        {
+            task(thread);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error)
+                error = std::current_exception();
+        }
+    });
+    if (error)
+        std::rethrow_exception(error);
+}
+
+// Finds the solved children of states that are visited in increasing order of key, through a move in one cell.
+//
+// Adding the same mark to the same cell of each state adds the same amount to each key, so the children are also visited in
+// increasing order of key. The reader only moves forward, so it reads the level below once, whatever the number of states.
+class ChildReader
+{
+public:
+    explicit ChildReader(std::string const & path)
+        : path_(path)
+        , reader_(path, true)
+        , key_(0)
+        , entry_ {}
+        , valid_(false)
+    {
+    }
+
+    // Returns the entry of the state with the key. The key must not be less than the last one. Throws std::runtime_error if
+    // the level does not have the state.
+    Tablebase::Entry const & find(uint64_t key)
+    {
+        while (!valid_ || key_ < key)
+        {
+            valid_ = reader_.next(&key_, &entry_);
+            if (!valid_)
+                break;
+        }
+        if (!valid_ || key_ != key)
+            throw std::runtime_error("Level file " + path_ + " is missing a state");
+        return entry_;
+    }
+
+private:
+    std::string      path_;   // Name of the file, for errors
+    LevelReader      reader_; // The solved level below
+    uint64_t         key_;    // The last key read
+    Tablebase::Entry entry_;  // The entry of the last key read
+    bool             valid_;  // True if a key has been read
+};
+
+MnkSolver::MnkSolver(Options const & options)
+    : options_(options)
+    , cells_(options.rows * options.columns)
+    , full_(0)
+    , pool_(options.threads)
+{
+    if (options_.rows < 1 || options_.columns < 1 || cells_ > MAX_CELLS)
+        throw std::runtime_error("The board must have between 1 and " + std::to_string(MAX_CELLS) + " cells");
+    if (options_.k < 1 || options_.k > std::max(options_.rows, options_.columns))
+        throw std::runtime_error("A line of " + std::to_string(options_.k) + " does not fit on the board");
+    assert(options_.batchSize > 0 && options_.chunkSize > 0);
+
+    // Lines of k cells in each direction: across, down, and both diagonals
+    Tables::forEachLine(options_.rows, options_.columns, options_.k, [this](int first, int step) {
+        uint64_t line = 0;
+        for (int i = 0; i < options_.k; ++i)
+        {
+            line |= uint64_t(1) << (first + i * step);
+        }
+        lines_.push_back(line);
+    });
+
+    full_ = (uint64_t(1) << cells_) - 1;
+
+    uint64_t power = 1;
+    for (int i = 0; i < cells_; ++i)
+    {
+        powers_.push_back(power);
+        power *= 3;
+    }
+}
+
+uint64_t MnkSolver::solve(std::string const & path)
+{
+    namespace fs = std::filesystem;
+
+    fs::create_directories(options_.workDirectory);
+    checkpoint();
+
+    // Forward pass. A level has been found if its keys or its solved states have been written.
+    if (!fs::exists(keysPath(0)) && !fs::exists(solvedPath(0)))
+    {
+        LevelWriter writer(keysPath(0), false, options_.chunkSize);
+        writer.add(0); // The empty board
+        writer.finish();
+    }
+    for (int level = 0; level < cells_; ++level)
+    {
+        if (!fs::exists(keysPath(level + 1)) && !fs::exists(solvedPath(level + 1)))
+            findLevel(level);
+    }
+
+    // Backward pass
+    for (int level = cells_; level >= 0; --level)
+    {
+        if (!fs::exists(solvedPath(level)))
+            solveLevel(level);
+    }
+
+    uint64_t count = writeTablebase(path);
+
+    // The checkpoints are no longer needed. The work directory is removed only if nothing else is in it.
+    for (int level = 0; level <= cells_; ++level)
+    {
+        fs::remove(solvedPath(level));
+    }
+    fs::remove(checkpointPath());
+    std::error_code error;
+    fs::remove(options_.workDirectory, error);
+    return count;
+}
+
+void MnkSolver::findLevel(int level)
+{
+    int const      threads = pool_.size();
+    uint64_t const mark    = this->mark(level);
+
+    // Expand the states a batch at a time. Each thread writes the children it finds as a sorted run.
+    LevelReader                        reader(keysPath(level), false);
+    std::vector<uint64_t>              batch;
+    std::vector<std::vector<uint64_t>> children(threads);
+    int                                runs = 0;
+    while (reader.read(options_.batchSize, &batch) > 0)
+    {
+        std::atomic<size_t> next(0);
+        runAll(pool_, [&](int thread) {
+            std::vector<uint64_t> & found = children[thread];
+            found.clear();
+            for (size_t begin; (begin = next.fetch_add(SLICE_SIZE)) < batch.size();)
+            {
+                size_t end = std::min(begin + SLICE_SIZE, batch.size());
+                for (size_t i = begin; i < end; ++i)
+                {
+                    Tablebase::Entry over;
+                    for (uint64_t moves = findMoves(batch[i], &over); moves != 0; moves &= moves - 1)
+                    {
+                        found.push_back(batch[i] + mark * powers_[Bits::firstIndex(moves)]);
+                    }
+                }
+            }
+            std::sort(found.begin(), found.end());
+            found.erase(std::unique(found.begin(), found.end()), found.end());
+
+            LevelWriter writer(runPath(level + 1, runs + thread), false, options_.chunkSize);
+            for (uint64_t key : found)
+            {
+                writer.add(key);
+            }
+            writer.finish();
+        });
+        runs += threads;
+        batch.clear();
+    }
+
+    // Merge the runs into the next level. A state can be reached from more than one state, so it can be in more than one
+    // run.
+    using Head = std::pair<uint64_t, int>; // The next key of a run, and the run
+    std::vector<std::unique_ptr<LevelReader>>                        readers;
+    std::priority_queue<Head, std::vector<Head>, std::greater<Head>> heads;
+    for (int run = 0; run < runs; ++run)
+    {
+        readers.push_back(std::make_unique<LevelReader>(runPath(level + 1, run), false));
+        uint64_t key;
+        if (readers.back()->next(&key))
+            heads.push({ key, run });
+    }
+
+    LevelWriter writer(keysPath(level + 1), false, options_.chunkSize);
+    bool        first = true;
+    uint64_t    last  = 0;
+    while (!heads.empty())
+    {
+        auto [key, run] = heads.top();
+        heads.pop();
+        if (first || key != last)
+            writer.add(key);
+        first = false;
+        last  = key;
+        if (readers[run]->next(&key))
+            heads.push({ key, run });
+    }
+    writer.finish();
+
+    readers.clear();
+    for (int run = 0; run < runs; ++run)
+    {
+        std::filesystem::remove(runPath(level + 1, run));
+    }
+}
+
+void MnkSolver::solveLevel(int level)
+{
+    // The children of the states at this level are the solved states at the next level. That level is not loaded into
+    // memory. Instead, there is a reader of it for each cell, which finds the children through a move in that cell in step
+    // with the states at this level.
+    std::vector<std::unique_ptr<ChildReader>> children;
+    if (level < cells_)
+    {
+        for (int cell = 0; cell < cells_; ++cell)
+        {
+            children.push_back(std::make_unique<ChildReader>(solvedPath(level + 1)));
+        }
+    }
+    uint64_t const mark = this->mark(level);
+
+    // For each state in a batch, the cells in which it has a move, the entry of its child through each cell, and its entry
+    LevelReader                                reader(keysPath(level), false);
+    LevelWriter                                writer(solvedPath(level), true, options_.chunkSize);
+    std::vector<uint64_t>                      batch;
+    std::vector<uint64_t>                      moves;
+    std::vector<std::vector<Tablebase::Entry>> found(children.size());
+    std::vector<Tablebase::Entry>              solved;
+    while (reader.read(options_.batchSize, &batch) > 0)
+    {
+        // Find the moves of each state. A state with no moves is already solved.
+        moves.resize(batch.size());
+        solved.resize(batch.size());
+        std::atomic<size_t> next(0);
+        runAll(pool_, [&](int) {
+            for (size_t begin; (begin = next.fetch_add(SLICE_SIZE)) < batch.size();)
+            {
+                size_t end = std::min(begin + SLICE_SIZE, batch.size());
+                for (size_t i = begin; i < end; ++i)
+                {
+                    moves[i] = findMoves(batch[i], &solved[i]);
+                }
+            }
+        });
+
+        // Find the children through each cell. Only one thread at a time uses the reader of a cell.
+        std::atomic<int> nextCell(0);
+        runAll(pool_, [&](int) {
+            for (int cell; (cell = nextCell.fetch_add(1)) < static_cast<int>(children.size());)
+            {
+                uint64_t                        bit     = uint64_t(1) << cell;
+                std::vector<Tablebase::Entry> & entries = found[cell];
+                entries.resize(batch.size());
+                for (size_t i = 0; i < batch.size(); ++i)
+                {
+                    if (moves[i] & bit)
+                        entries[i] = children[cell]->find(batch[i] + mark * powers_[cell]);
+                }
+            }
+        });
+
+        // Choose the best move of each state that has moves
+        next = 0;
+        runAll(pool_, [&](int) {
+            for (size_t begin; (begin = next.fetch_add(SLICE_SIZE)) < batch.size();)
+            {
+                size_t end = std::min(begin + SLICE_SIZE, batch.size());
+                for (size_t i = begin; i < end; ++i)
+                {
+                    if (moves[i] != 0)
+                        solved[i] = solveState(moves[i], found, i);
+                }
+            }
+        });
+
+        for (size_t i = 0; i < batch.size(); ++i)
+        {
+            writer.add(batch[i], solved[i]);
+        }
+        batch.clear();
+    }
+    writer.finish();
+
+    // The keys are in the solved level now
+    std::filesystem::remove(keysPath(level));
+}
+
+uint64_t MnkSolver::writeTablebase(std::string const & path)
+{
+    // The keys come before the entries in a tablebase, so the entries are written to a separate file while the levels are
+    // merged, and then appended. The count is not known until the end, so the header is written last.
+    std::string   temporary   = path + ".tmp";
+    std::string   entriesPath = (std::filesystem::path(options_.workDirectory) / "entries.tmp").string();
+    std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+    std::ofstream entries(entriesPath, std::ios::binary | std::ios::trunc);
+    if (!file || !entries)
+        throw std::runtime_error("Cannot create tablebase " + path);
+
+    Tablebase::Header header =
+        Tablebase::makeHeader(options_.rows, options_.columns, options_.k, Tablebase::Indexing::SORTED, 0);
+    file.write(reinterpret_cast<char const *>(&header), sizeof(header));
+
+    // Merge the levels. Each state is at only one level, so there are no duplicates.
+    using Head = std::pair<uint64_t, int>; // The next key of a level, and the level
+    std::vector<std::unique_ptr<LevelReader>>                        readers;
+    std::vector<Tablebase::Entry>                                    current(cells_ + 1);
+    std::priority_queue<Head, std::vector<Head>, std::greater<Head>> heads;
+    for (int level = 0; level <= cells_; ++level)
+    {
+        readers.push_back(std::make_unique<LevelReader>(solvedPath(level), true));
+        uint64_t key;
+        if (readers.back()->next(&key, &current[level]))
+            heads.push({ key, level });
+    }
+
+    uint64_t count = 0;
+    while (!heads.empty())
+    {
+        auto [key, level] = heads.top();
+        heads.pop();
+        file.write(reinterpret_cast<char const *>(&key), sizeof(key));
+        entries.write(reinterpret_cast<char const *>(&current[level]), sizeof(Tablebase::Entry));
+        ++count;
+        if (readers[level]->next(&key, &current[level]))
+            heads.push({ key, level });
+    }
+    entries.close();
+
+    {
+        std::ifstream source(entriesPath, std::ios::binary);
+        file << source.rdbuf();
+    }
+    header.count = count;
+    file.seekp(0);
+    file.write(reinterpret_cast<char const *>(&header), sizeof(header));
+    file.close();
+    std::filesystem::remove(entriesPath);
+    if (!file || !entries)
+    {
+        std::filesystem::remove(temporary);
+        throw std::runtime_error("Cannot write tablebase " + path);
+    }
+    std::filesystem::rename(temporary, path);
+    return count;
+}
+
+uint64_t MnkSolver::findMoves(uint64_t key, Tablebase::Entry * pOver) const
+{
+    uint64_t x;
+    uint64_t o;
+    decode(key, &x, &o);
+    bool xToMove = Bits::count(x) == Bits::count(o);
+    if (hasLine(xToMove ? o : x))
+    {
+        *pOver = { -1, 0, -1, Tablebase::VALID };
+        return 0;
+    }
+    if ((x | o) == full_)
+    {
+        *pOver = { 0, 0, -1, Tablebase::VALID };
+        return 0;
+    }
+    return full_ & ~(x | o);
+}
+
+Tablebase::Entry MnkSolver::solveState(uint64_t                                          moves,
+                                       std::vector<std::vector<Tablebase::Entry>> const & children,
+                                       size_t                                            i) const
+{
+    assert(moves != 0);
+    Tablebase::Entry best = { -1, 0, -1, Tablebase::VALID };
+    for (; moves != 0; moves &= moves - 1)
+    {
+        int                      cell  = Bits::firstIndex(moves);
+        Tablebase::Entry const & child = children[cell][i];
+
+        int value    = -child.value;
+        int distance = child.distance + 1;
+        if (best.bestMove < 0 || Retrograde::isBetter(value, distance, best.value, best.distance))
+        {
+            best.value    = static_cast<int8_t>(value);
+            best.distance = static_cast<uint8_t>(distance);
+            best.bestMove = static_cast<int8_t>(cell);
+        }
+    }
+    return best;
+}
+
+void MnkSolver::decode(uint64_t key, uint64_t * pX, uint64_t * pO) const
+{
+    uint64_t x = 0;
+    uint64_t o = 0;
+    for (int i = 0; key != 0; ++i, key /= 3)
+    {
+        uint64_t digit = key % 3;
+        if (digit == 1)
+            x |= uint64_t(1) << i;
+        else if (digit == 2)
+            o |= uint64_t(1) << i;
+    }
+    *pX = x;
+    *pO = o;
+}
+
+bool MnkSolver::hasLine(uint64_t marks) const
+{
+    for (uint64_t line : lines_)
+    {
+        if ((marks & line) == line)
+            return true;
+    }
+    return false;
+}
+
+void MnkSolver::checkpoint() const
+{
+    std::string path = checkpointPath();
+    {
+        std::ifstream file(path);
+        if (file)
+        {
+            int rows    = 0;
+            int columns = 0;
+            int k       = 0;
+            file >> rows >> columns >> k;
+            if (rows != options_.rows || columns != options_.columns || k != options_.k)
+                throw std::runtime_error("The work directory " + options_.workDirectory + " is for a different game");
+            return;
+        }
+    }
+
+    std::ofstream file(path, std::ios::trunc);
+    file << options_.rows << " " << options_.columns << " " << options_.k << "\n";
+    if (!file)
+        throw std::runtime_error("Cannot write " + path);
+}
+
+std::string MnkSolver::keysPath(int level) const
+{
+    return (std::filesystem::path(options_.workDirectory) / ("keys-" + std::to_string(level))).string();
+}
+
+std::string MnkSolver::solvedPath(int level) const
+{
+    return (std::filesystem::path(options_.workDirectory) / ("solved-" + std::to_string(level))).string();
+}
+
+std::string MnkSolver::runPath(int level, int run) const
+{
+    return (std::filesystem::path(options_.workDirectory) / ("run-" + std::to_string(level) + "-" + std::to_string(run)))
+        .string();
+}
+
+std::string MnkSolver::checkpointPath() const
+{
+    return (std::filesystem::path(options_.workDirectory) / "checkpoint").string();
+}
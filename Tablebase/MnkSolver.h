@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Tablebase.h"
+
+#include "Components/Tables.h"
+#include "ComputerPlayer/ThreadPool.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Solves m,n,k games (k in a row on a board with m rows and n columns) by retrograde analysis, for boards too big to solve
+// in memory.
+//
+// The solver works one level (number of marks) at a time, and keeps the levels on disk as sorted, compressed level files
+// (see LevelFile.h). In the forward pass, the states at each level are expanded in batches by all of the threads, and each
+// thread's sorted children are written as a run that is merged with the others into the next level. In the backward pass,
+// the levels are solved from the last to the first, a batch at a time. The solved level below is read in step with the
+// level being solved, once for each cell, so no level is ever held in memory. Every finished level file is a checkpoint: if
+// the solver is stopped, running it again with the same work directory continues from the last finished level.
+//
+// The result is written as a tablebase with SORTED indexing, whose key is the rank of the board: the sum of 3^i times the
+// mark in cell i (1 for X and 2 for O), with the cells in row-major order. For a 3x3 board this is Board::rank().
+class MnkSolver
+{
+public:
+    // The largest number of cells. The tablebase is keyed by rank, so it can only be played on a board with ranks.
+    static int constexpr MAX_CELLS = Tables::MAX_RANKED_CELLS;
+
+    // Solver options
+    struct Options
+    {
+        int         rows          = 3;                // Number of rows
+        int         columns       = 3;                // Number of columns
+        int         k             = 3;                // Number of marks in a line needed to win
+        int         threads       = 0;                // Number of threads, or 0 for one per hardware thread
+        std::string workDirectory = "tablebase-work"; // Directory of the level files and checkpoints
+        size_t      batchSize     = 1 << 20;          // Number of states expanded or solved at a time
+        size_t      chunkSize     = 4096;             // Number of keys in each chunk of a level file
+    };
+
+    // Constructor. Throws std::runtime_error if the board is too big or k does not fit on it.
+    explicit MnkSolver(Options const & options);
+
+    // Solves the game and writes the tablebase, continuing from any checkpoints in the work directory. The level files are
+    // removed when the tablebase has been written. Returns the number of states. Throws std::runtime_error if a file cannot
+    // be read or written, or if the work directory holds the checkpoints of a different game.
+    uint64_t solve(std::string const & path);
+
+private:
+    // Writes the states at the next level, by expanding the states at this level
+    void findLevel(int level);
+
+    // Writes the solved states at this level, using the solved states at the next level
+    void solveLevel(int level);
+
+    // Merges the solved levels into the tablebase, and returns the number of states
+    uint64_t writeTablebase(std::string const & path);
+
+    // Returns the mask of the cells in which the player to move in the state with the key can move. If the game is over,
+    // returns 0 and sets the entry of the state.
+    uint64_t findMoves(uint64_t key, Tablebase::Entry * pOver) const;
+
+    // Returns the entry for a state with moves in the specified cells, given the entry of each of its children. The entry
+    // of the child through a move in cell c is children[c][i].
+    Tablebase::Entry solveState(uint64_t                                          moves,
+                                std::vector<std::vector<Tablebase::Entry>> const & children,
+                                size_t                                            i) const;
+
+    // Returns the mark of the player to move at the level: 1 for X and 2 for O
+    static uint64_t mark(int level) { return (level % 2 == 0) ? 1 : 2; }
+
+    // Finds the masks of the cells with Xs and with Os on the board with the key
+    void decode(uint64_t key, uint64_t * pX, uint64_t * pO) const;
+
+    // Returns true if the marks make a line
+    bool hasLine(uint64_t marks) const;
+
+    // Checks the work directory's checkpoint, or starts one
+    void checkpoint() const;
+
+    // Returns the names of the files in the work directory
+    std::string keysPath(int level) const;
+    std::string solvedPath(int level) const;
+    std::string runPath(int level, int run) const;
+    std::string checkpointPath() const;
+
+    Options               options_; // Solver options
+    int                   cells_;   // Number of cells
+    uint64_t              full_;    // Mask of all of the cells
+    std::vector<uint64_t> lines_;   // Masks of the lines of k cells
+    std::vector<uint64_t> powers_;  // 3^i for each cell i
+    ThreadPool            pool_;    // Threads that share each batch
+};
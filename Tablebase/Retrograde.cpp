@@ -0,0 +1,95 @@
+#include "Retrograde.h"
+
+#include "Components/Board.h"
+#include "TicTacToeState/TicTacToeState.h"
+
+#include <array>
+
+// Returns the state with the specified index
+static TicTacToeState stateOf(int index)
+{
+    auto player = (index % 2 == 0) ? TicTacToeState::PlayerId::ALICE : TicTacToeState::PlayerId::BOB;
+    return TicTacToeState(Board::unrank(index / 2), player);
+}
+
+// Returns the entry for a state. The entries of the states one level later must be solved.
+static Tablebase::Entry solveState(TicTacToeState & state, std::vector<Tablebase::Entry> const & entries)
+{
+    if (state.isDone())
+    {
+        int8_t value = (state.winner() != Board::Cell::NEITHER) ? -1 : 0;
+        return { value, 0, -1, Tablebase::VALID };
+    }
+
+    TicTacToeState::MoveList moves;
+    state.generateMoves(&moves);
+    Tablebase::Entry best = { -1, 0, -1, Tablebase::VALID };
+    for (TicTacToeState::Move const & move : moves)
+    {
+        state.move(move.row, move.column);
+        Tablebase::Entry const & child = entries[state.index()];
+        state.unmove();
+
+        int value    = -child.value;
+        int distance = child.distance + 1;
+        if (best.bestMove < 0 || Retrograde::isBetter(value, distance, best.value, best.distance))
+        {
+            best.value    = static_cast<int8_t>(value);
+            best.distance = static_cast<uint8_t>(distance);
+            best.bestMove = static_cast<int8_t>(Board::toIndex(move.row, move.column));
+        }
+    }
+    return best;
+}
+
+namespace Retrograde
+{
+bool isBetter(int value, int distance, int bestValue, int bestDistance)
+{
+    if (value != bestValue)
+        return value > bestValue;
+    return (value > 0) ? distance < bestDistance : (value < 0) ? distance > bestDistance : false;
+}
+
+std::vector<Tablebase::Entry> solve()
+{
+    std::vector<Tablebase::Entry> entries(TicTacToeState::NUMBER_OF_INDEXES, Tablebase::Entry { 0, 0, -1, 0 });
+
+    // Find the reachable states, one level at a time. An entry is marked valid when its state is found.
+    std::array<std::vector<int>, 10> levels;
+    int                              start = TicTacToeState().index();
+    levels[0].push_back(start);
+    entries[start].flags = Tablebase::VALID;
+    for (int level = 0; level < 9; ++level)
+    {
+        for (int index : levels[level])
+        {
+            TicTacToeState           state = stateOf(index);
+            TicTacToeState::MoveList moves;
+            state.generateMoves(&moves);
+            for (TicTacToeState::Move const & move : moves)
+            {
+                state.move(move.row, move.column);
+                int child = state.index();
+                if (!(entries[child].flags & Tablebase::VALID))
+                {
+                    entries[child].flags = Tablebase::VALID;
+                    levels[level + 1].push_back(child);
+                }
+                state.unmove();
+            }
+        }
+    }
+
+    // Solve the levels from the last to the first
+    for (int level = 9; level >= 0; --level)
+    {
+        for (int index : levels[level])
+        {
+            TicTacToeState state = stateOf(index);
+            entries[index]       = solveState(state, entries);
+        }
+    }
+    return entries;
+}
+} // namespace Retrograde
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Tablebase.h"
+
+#include <vector>
+
+// Solves tic-tac-toe by retrograde analysis.
+//
+// The reachable states are found by making every move from the empty board, one level (number of marks) at a time. The
+// levels are then solved from the last to the first. A state at which the game is over is a loss for the player to move if
+// the other player has won, and otherwise a draw. The result of any other state follows from the results of the states one
+// level later, which are already solved.
+namespace Retrograde
+{
+// Returns the solution as tablebase entries indexed by state index (see TicTacToeState::index()). The entries of unreachable
+// states are not valid.
+std::vector<Tablebase::Entry> solve();
+
+// Returns true if a move with the first value and distance is better than a move with the second. A win is better sooner
+// and a loss is better later.
+bool isBetter(int value, int distance, int bestValue, int bestDistance);
+} // namespace Retrograde
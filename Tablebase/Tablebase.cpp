@@ -0,0 +1,168 @@
+#include "Tablebase.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static char const MAGIC[8] = { 'T', 'T', 'T', 'B', 'A', 'S', 'E', '\0' };
+
+// Maps a file read-only and returns its address and size. Throws std::runtime_error on failure.
+static std::pair<void const *, size_t> map(std::string const & path)
+{
+#if defined(_WIN32)
+    HANDLE file =
+        CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        throw std::runtime_error("Cannot open tablebase " + path);
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+    {
+        CloseHandle(file);
+        throw std::runtime_error("Cannot read tablebase " + path);
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr)
+        throw std::runtime_error("Cannot map tablebase " + path);
+    void const * data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping); // The view keeps the mapping open
+    if (data == nullptr)
+        throw std::runtime_error("Cannot map tablebase " + path);
+    return { data, static_cast<size_t>(size.QuadPart) };
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error("Cannot open tablebase " + path);
+    struct stat status;
+    if (fstat(fd, &status) != 0 || status.st_size == 0)
+    {
+        close(fd);
+        throw std::runtime_error("Cannot read tablebase " + path);
+    }
+    void * data = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd); // The mapping keeps the file open
+    if (data == MAP_FAILED)
+        throw std::runtime_error("Cannot map tablebase " + path);
+    return { data, static_cast<size_t>(status.st_size) };
+#endif
+}
+
+// Unmaps a file mapped by map()
+static void unmap(void const * data, size_t size)
+{
+#if defined(_WIN32)
+    (void)size;
+    UnmapViewOfFile(data);
+#else
+    munmap(const_cast<void *>(data), size);
+#endif
+}
+
+Tablebase::Tablebase(std::string const & path)
+    : data_(nullptr)
+    , size_(0)
+    , header_(nullptr)
+    , keys_(nullptr)
+    , entries_(nullptr)
+{
+    std::tie(data_, size_) = map(path);
+    header_                = static_cast<Header const *>(data_);
+
+    // Check that the file is a tablebase that this version can read, and that it is big enough for its entries
+    char const * error = nullptr;
+    if (size_ < sizeof(Header) || std::memcmp(header_->magic, MAGIC, sizeof(MAGIC)) != 0)
+        error = "is not a tablebase";
+    else if (header_->byteOrder != BYTE_ORDER_MARK)
+        error = "was written by a host with a different byte order";
+    else if (header_->version != VERSION)
+        error = "has an unsupported version";
+    else if (header_->indexing != Indexing::DENSE && header_->indexing != Indexing::SORTED)
+        error = "has an unsupported indexing";
+    else
+    {
+        size_t keySize = (header_->indexing == Indexing::SORTED) ? sizeof(uint64_t) : 0;
+        if ((size_ - sizeof(Header)) / (keySize + sizeof(Entry)) < header_->count)
+            error = "is truncated";
+    }
+    if (error)
+    {
+        unmap(data_, size_);
+        throw std::runtime_error("Tablebase " + path + " " + error);
+    }
+
+    char const * p = static_cast<char const *>(data_) + sizeof(Header);
+    if (header_->indexing == Indexing::SORTED)
+    {
+        keys_ = reinterpret_cast<uint64_t const *>(p);
+        p += header_->count * sizeof(uint64_t);
+    }
+    entries_ = reinterpret_cast<Entry const *>(p);
+}
+
+Tablebase::~Tablebase()
+{
+    unmap(data_, size_);
+}
+
+Tablebase::Entry const * Tablebase::find(uint64_t key) const
+{
+    if (header_->indexing == Indexing::DENSE)
+    {
+        if (key >= header_->count)
+            return nullptr;
+        Entry const * entry = &entries_[key];
+        return (entry->flags & VALID) ? entry : nullptr;
+    }
+
+    uint64_t const * end   = keys_ + header_->count;
+    uint64_t const * found = std::lower_bound(keys_, end, key);
+    return (found != end && *found == key) ? &entries_[found - keys_] : nullptr;
+}
+
+Tablebase::Header Tablebase::makeHeader(int rows, int columns, int k, Indexing indexing, uint64_t count)
+{
+    Header header;
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version   = VERSION;
+    header.rows      = static_cast<uint8_t>(rows);
+    header.columns   = static_cast<uint8_t>(columns);
+    header.k         = static_cast<uint8_t>(k);
+    header.indexing  = indexing;
+    header.count     = count;
+    header.byteOrder = BYTE_ORDER_MARK;
+    return header;
+}
+
+void Tablebase::write(std::string const &           path,
+                      Header const &                header,
+                      std::vector<uint64_t> const & keys,
+                      std::vector<Entry> const &    entries)
+{
+    assert(entries.size() == header.count);
+    assert(keys.size() == ((header.indexing == Indexing::SORTED) ? entries.size() : 0));
+    assert(std::is_sorted(keys.begin(), keys.end()));
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+        throw std::runtime_error("Cannot create tablebase " + path);
+
+    file.write(reinterpret_cast<char const *>(&header), sizeof(header));
+    file.write(reinterpret_cast<char const *>(keys.data()), keys.size() * sizeof(uint64_t));
+    file.write(reinterpret_cast<char const *>(entries.data()), entries.size() * sizeof(Entry));
+    file.flush();
+    if (!file)
+        throw std::runtime_error("Cannot write tablebase " + path);
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// A table of the results of perfect play from every reachable state, read from a memory-mapped file.
+//
+// The file is mapped read-only, so opening it does no work beyond checking the header, a lookup is one memory access, and
+// every process that opens the same file shares the same pages. The file format is:
+//
+//   Header  - 32 bytes (see Header)
+//   Keys    - SORTED only: count 64-bit keys in increasing order
+//   Entries - count 4-byte entries (see Entry)
+//
+// With DENSE indexing, entry i is for the state with index i (see TicTacToeState::index()), and unreachable states have
+// invalid entries. With SORTED indexing, entry i is for the state whose key is keys[i], and only reachable states are stored.
+// The key of a state is the rank of its board (the board read as a base-3 number), since the player to move follows from the
+// number of marks. A key has 64 bits, so SORTED tables can only be made for boards with ranks, which have at most
+// Tables::MAX_RANKED_CELLS cells (see BasicBoard::HAS_RANKS).
+//
+// Integers are stored in the byte order of the host that wrote the file, so that the file can be used in place when it is
+// mapped. The header holds BYTE_ORDER_MARK in that order, so a file written by a host with another byte order is rejected.
+class Tablebase
+{
+public:
+    // Version of the file format
+    static uint32_t constexpr VERSION = 2;
+
+    // Value of Header::byteOrder. Its bytes are all different, so it reads differently in any other byte order.
+    static uint64_t constexpr BYTE_ORDER_MARK = 0x0102030405060708;
+
+    // How the entries are found
+    enum class Indexing : uint8_t
+    {
+        DENSE, // Entries are indexed by the state index
+        SORTED // Entries are found by searching the sorted keys
+    };
+
+    // The header of a file
+    struct Header
+    {
+        char     magic[8];  // "TTTBASE" followed by a 0
+        uint32_t version;   // Version of the file format
+        uint8_t  rows;      // Number of rows of the board
+        uint8_t  columns;   // Number of columns of the board
+        uint8_t  k;         // Number of marks in a line needed to win
+        Indexing indexing;  // How the entries are found
+        uint64_t count;     // Number of entries
+        uint64_t byteOrder; // BYTE_ORDER_MARK, in the byte order of the file
+    };
+
+    static_assert(sizeof(Header) == 32, "The header must match the file format");
+
+    // The result of perfect play from a state
+    struct Entry
+    {
+        int8_t  value;    // For the player to move: 1 for a win, 0 for a draw, -1 for a loss
+        uint8_t distance; // Number of plies to the end of the game, winning as soon as possible or losing as late as possible
+        int8_t  bestMove; // Index of the cell of the best move, or -1 if the game is over
+        uint8_t flags;    // VALID if the state is reachable
+    };
+
+    static_assert(sizeof(Entry) == 4, "An entry must match the file format");
+
+    // Flag of an entry for a reachable state
+    static uint8_t constexpr VALID = 1;
+
+    // Constructor. Maps the file. Throws std::runtime_error if the file cannot be mapped or is not a valid tablebase.
+    explicit Tablebase(std::string const & path);
+
+    // Destructor. Unmaps the file.
+    ~Tablebase();
+
+    Tablebase(Tablebase const &)              = delete;
+    Tablebase & operator =(Tablebase const &) = delete;
+
+    // Returns the header
+    Header const & header() const { return *header_; }
+
+    // Returns the entry for the state, or nullptr if there is none. The board must be the size of the table's board, and
+    // have ranks (see BasicBoard::HAS_RANKS).
+    template <typename State>
+    Entry const * find(State const & state) const
+    {
+        assert(header_->rows == State::Board::ROWS && header_->columns == State::Board::COLUMNS);
+        auto key = (header_->indexing == Indexing::DENSE) ? state.index() : state.rank();
+        return find(static_cast<uint64_t>(key));
+    }
+
+    // Returns the entry with the specified key, or nullptr if there is none. The key is the state index for DENSE indexing,
+    // and the rank of the board for SORTED indexing.
+    Entry const * find(uint64_t key) const;
+
+    // Returns a header for a table with the specified properties
+    static Header makeHeader(int rows, int columns, int k, Indexing indexing, uint64_t count);
+
+    // Writes a table. The keys must be empty for DENSE indexing, and match the entries for SORTED indexing. Throws
+    // std::runtime_error if the file cannot be written.
+    static void write(std::string const &           path,
+                      Header const &                header,
+                      std::vector<uint64_t> const & keys,
+                      std::vector<Entry> const &    entries);
+
+private:
+    void const *     data_;    // The mapped file
+    size_t           size_;    // Size of the mapped file
+    Header const *   header_;  // The header, at the start of the file
+    uint64_t const * keys_;    // The keys (SORTED only), or nullptr
+    Entry const *    entries_; // The entries
+};
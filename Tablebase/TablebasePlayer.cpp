@@ -0,0 +1,3 @@
+#include "TablebasePlayer.h"
+
+template class BasicTablebasePlayer<TicTacToeState>;
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Components/Player.h"
+#include "Tablebase.h"
+
+#include <cassert>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+// A computer player that plays perfectly by looking up its moves in a tablebase, in a game played with the specified State.
+//
+// No search is done, so a move takes one lookup. The tablebase is shared, so any number of players can use the same mapped
+// file. The table must be for the state's board, which must have ranks (see BasicBoard::HAS_RANKS), since the states are
+// found by their indexes or ranks. The player of the 3x3 game is TablebasePlayer.
+template <typename State>
+class BasicTablebasePlayer : public BasicPlayer<State>
+{
+public:
+    using Board    = typename State::Board;
+    using PlayerId = typename State::PlayerId;
+
+    static_assert(Board::HAS_RANKS, "A tablebase can only be used with a board that has ranks");
+
+    // Constructor. Throws std::runtime_error if the tablebase is not for the state's board.
+    BasicTablebasePlayer(PlayerId playerId, std::shared_ptr<Tablebase const> tablebase);
+
+    // Gets a move from the tablebase and applies it to the game state. If the state is not in the tablebase, the move is to
+    // the first empty cell. Overrides BasicPlayer::move().
+    virtual void move(State * pState) override;
+
+private:
+    std::shared_ptr<Tablebase const> tablebase_; // The tablebase
+};
+
+// A player of the 3x3 game
+using TablebasePlayer = BasicTablebasePlayer<TicTacToeState>;
+
+template <typename State>
+BasicTablebasePlayer<State>::BasicTablebasePlayer(PlayerId playerId, std::shared_ptr<Tablebase const> tablebase)
+    : BasicPlayer<State>(playerId)
+    , tablebase_(std::move(tablebase))
+{
+    assert(tablebase_);
+
+    // The moves in the table are indexes of cells on its board, so they are only valid if the board is the same
+    Tablebase::Header const & header = tablebase_->header();
+    if (header.rows != Board::ROWS || header.columns != Board::COLUMNS || header.k != Board::LINE_LENGTH)
+    {
+        throw std::runtime_error("Tablebase is for a " + std::to_string(header.rows) + "x" + std::to_string(header.columns) +
+                                 " board with k = " + std::to_string(header.k) + ", not " + std::to_string(Board::ROWS) +
+                                 "x" + std::to_string(Board::COLUMNS) + " with k = " + std::to_string(Board::LINE_LENGTH));
+    }
+}
+
+template <typename State>
+void BasicTablebasePlayer<State>::move(State * pState)
+{
+    // Let's be safe and check if the state is valid
+    if (pState == nullptr || pState->isDone())
+    {
+        return;
+    }
+
+    Tablebase::Entry const * entry = tablebase_->find(*pState);
+    int                      cell  = (entry && entry->bestMove >= 0) ? entry->bestMove
+                                                                     : Board::firstIndex(pState->board().emptyMask());
+    auto [row, column] = Board::toPosition(cell);
+    pState->move(row, column);
+}
+
+// The 3x3 player is compiled once, in TablebasePlayer.cpp
+extern template class BasicTablebasePlayer<TicTacToeState>;
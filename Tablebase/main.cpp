@@ -0,0 +1,110 @@
+#include "MnkSolver.h"
+#include "Retrograde.h"
+#include "Tablebase.h"
+
+#include "TicTacToeState/TicTacToeState.h"
+
+#include <CLI/CLI.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Returns a description of the result of a game for the first player
+static char const * describe(Tablebase::Entry const & start)
+{
+    return (start.value > 0) ? "a win for X" : (start.value < 0) ? "a win for O" : "a draw";
+}
+
+// Solves 3x3 tic-tac-toe in memory and writes a densely indexed tablebase
+static void solveTicTacToe(std::string const & output)
+{
+    auto                          begin   = std::chrono::steady_clock::now();
+    std::vector<Tablebase::Entry> entries = Retrograde::solve();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+
+    Tablebase::Header header = Tablebase::makeHeader(3, 3, 3, Tablebase::Indexing::DENSE, entries.size());
+    Tablebase::write(output, header, {}, entries);
+
+    unsigned long long reachable = 0;
+    unsigned long long wins      = 0;
+    unsigned long long losses    = 0;
+    for (Tablebase::Entry const & entry : entries)
+    {
+        if (entry.flags & Tablebase::VALID)
+        {
+            ++reachable;
+            wins += (entry.value > 0) ? 1 : 0;
+            losses += (entry.value < 0) ? 1 : 0;
+        }
+    }
+    Tablebase::Entry const & start = entries[TicTacToeState().index()];
+
+    std::printf("states: %llu\n", reachable);
+    std::printf("wins:   %llu\n", wins);
+    std::printf("losses: %llu\n", losses);
+    std::printf("draws:  %llu\n", reachable - wins - losses);
+    std::printf("result: %s in %d plies\n", describe(start), start.distance);
+    std::printf("time:   %.3f s\n", elapsed.count());
+    std::printf("wrote:  %s\n", output.c_str());
+}
+
+// Solves an m,n,k game on disk and writes a tablebase with sorted keys
+static void solveMnk(MnkSolver::Options const & options, std::string const & output)
+{
+    auto                          begin   = std::chrono::steady_clock::now();
+    uint64_t                      count   = MnkSolver(options).solve(output);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+
+    Tablebase                tablebase(output);
+    Tablebase::Entry const * start = tablebase.find(uint64_t(0)); // The empty board
+
+    std::printf("states: %llu\n", static_cast<unsigned long long>(count));
+    std::printf("result: %s in %d plies\n", describe(*start), start->distance);
+    std::printf("time:   %.3f s\n", elapsed.count());
+    std::printf("wrote:  %s\n", output.c_str());
+}
+
+int main(int argc, char * argv[])
+{
+    CLI::App cli("Solves tic-tac-toe, or any m,n,k game, and writes the results of perfect play from every reachable state "
+                 "to a tablebase.");
+
+    std::string        output = "tictactoe.tb";
+    MnkSolver::Options options;
+    cli.add_option("--output, -o", output, "The tablebase file to write")->capture_default_str();
+    cli.add_option("--rows, -r", options.rows, "Number of rows of the board")
+        ->capture_default_str()
+        ->check(CLI::PositiveNumber);
+    cli.add_option("--columns, -c", options.columns, "Number of columns of the board")
+        ->capture_default_str()
+        ->check(CLI::PositiveNumber);
+    cli.add_option("--k, -k", options.k, "Number of marks in a line needed to win")
+        ->capture_default_str()
+        ->check(CLI::PositiveNumber);
+    cli.add_option("--threads, -t", options.threads, "Number of threads, or 0 for one per hardware thread")
+        ->capture_default_str()
+        ->check(CLI::NonNegativeNumber);
+    cli.add_option("--work, -w", options.workDirectory, "Directory of the level files and checkpoints of an m,n,k solve")
+        ->capture_default_str();
+
+    CLI11_PARSE(cli, argc, argv);
+
+    try
+    {
+        // The 3x3 game is small enough to solve in memory, and its tablebase is indexed by the state index
+        if (options.rows == 3 && options.columns == 3 && options.k == 3)
+            solveTicTacToe(output);
+        else
+            solveMnk(options, output);
+    }
+    catch (std::exception const & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
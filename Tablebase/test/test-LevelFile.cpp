@@ -0,0 +1,94 @@
+#include "gtest/gtest.h"
+
+#include "Tablebase/LevelFile.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace TicTacToe
+{
+// Returns the path of a temporary file for a test
+static std::string temporaryPath(char const * name)
+{
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+TEST(LevelFile, Keys)
+{
+    std::string path = temporaryPath("test-LevelFile-keys");
+
+    // Keys with small and large gaps, over several chunks
+    std::vector<uint64_t> keys;
+    for (uint64_t key = 0; keys.size() < 1000; key += 1 + (key % 7) * 1000003)
+    {
+        keys.push_back(key);
+    }
+    keys.push_back(~uint64_t(0));
+    {
+        LevelWriter writer(path, false, 64);
+        for (uint64_t key : keys)
+        {
+            writer.add(key);
+        }
+        EXPECT_FALSE(std::filesystem::exists(path)); // Not until it is finished
+        EXPECT_EQ(writer.finish(), keys.size());
+    }
+
+    LevelReader reader(path, false);
+    uint64_t    key;
+    for (uint64_t expected : keys)
+    {
+        ASSERT_TRUE(reader.next(&key));
+        EXPECT_EQ(key, expected);
+    }
+    EXPECT_FALSE(reader.next(&key));
+    std::remove(path.c_str());
+}
+
+TEST(LevelFile, Entries)
+{
+    std::string path = temporaryPath("test-LevelFile-entries");
+    {
+        LevelWriter writer(path, true, 3);
+        for (int i = 0; i < 10; ++i)
+        {
+            writer.add(uint64_t(i * i), Tablebase::Entry { int8_t(i % 3 - 1), uint8_t(i), int8_t(i), Tablebase::VALID });
+        }
+        EXPECT_EQ(writer.finish(), 10u);
+    }
+
+    // Read in pieces that do not line up with the chunks
+    LevelReader                   reader(path, true);
+    std::vector<uint64_t>         keys;
+    std::vector<Tablebase::Entry> entries;
+    EXPECT_EQ(reader.read(4, &keys, &entries), 4u);
+    EXPECT_EQ(reader.read(100, &keys, &entries), 6u);
+    EXPECT_EQ(reader.read(100, &keys, &entries), 0u);
+    ASSERT_EQ(keys.size(), 10u);
+    ASSERT_EQ(entries.size(), 10u);
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(keys[i], uint64_t(i * i));
+        EXPECT_EQ(entries[i].value, i % 3 - 1);
+        EXPECT_EQ(entries[i].distance, i);
+        EXPECT_EQ(entries[i].bestMove, i);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(LevelFile, Unfinished)
+{
+    // A file that is not finished is never given its name
+    std::string path = temporaryPath("test-LevelFile-unfinished");
+    {
+        LevelWriter writer(path, false);
+        writer.add(1);
+    }
+    EXPECT_FALSE(std::filesystem::exists(path));
+    EXPECT_FALSE(std::filesystem::exists(path + ".tmp"));
+    EXPECT_THROW(LevelReader(path, false), std::runtime_error);
+}
+} // namespace TicTacToe
@@ -0,0 +1,121 @@
+#include "gtest/gtest.h"
+
+#include "Tablebase/MnkSolver.h"
+#include "Tablebase/Retrograde.h"
+#include "Tablebase/Tablebase.h"
+#include "TicTacToeState/TicTacToeState.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+namespace TicTacToe
+{
+// Returns options for a test that solves a game in the specified work directory. The batches and chunks are small so that
+// the levels are split into many of them.
+static MnkSolver::Options testOptions(int rows, int columns, int k, char const * workDirectory)
+{
+    MnkSolver::Options options;
+    options.rows          = rows;
+    options.columns       = columns;
+    options.k             = k;
+    options.threads       = 4;
+    options.workDirectory = (std::filesystem::temp_directory_path() / workDirectory).string();
+    options.batchSize     = 100;
+    options.chunkSize     = 16;
+    return options;
+}
+
+TEST(MnkSolver, Solve_3x3)
+{
+    MnkSolver::Options options = testOptions(3, 3, 3, "test-MnkSolver-3x3");
+    std::string        path    = (std::filesystem::temp_directory_path() / "test-MnkSolver-3x3.tb").string();
+    EXPECT_EQ(MnkSolver(options).solve(path), 5478u);
+    EXPECT_FALSE(std::filesystem::exists(options.workDirectory));
+
+    // The results match the solution in memory, since the key is the rank of the board
+    std::vector<Tablebase::Entry> expected = Retrograde::solve();
+    {
+        Tablebase tablebase(path);
+        EXPECT_EQ(tablebase.header().indexing, Tablebase::Indexing::SORTED);
+        for (int index = 0; index < TicTacToeState::NUMBER_OF_INDEXES; ++index)
+        {
+            if (expected[index].flags & Tablebase::VALID)
+            {
+                Tablebase::Entry const * entry = tablebase.find(uint64_t(index / 2));
+                ASSERT_NE(entry, nullptr);
+                EXPECT_EQ(entry->value, expected[index].value);
+                EXPECT_EQ(entry->distance, expected[index].distance);
+            }
+        }
+        EXPECT_NE(tablebase.find(TicTacToeState()), nullptr);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(MnkSolver, Solve_mnk)
+{
+    std::string path = (std::filesystem::temp_directory_path() / "test-MnkSolver-mnk.tb").string();
+
+    // X wins on a 2x2 board with its second mark
+    {
+        MnkSolver(testOptions(2, 2, 2, "test-MnkSolver-mnk")).solve(path);
+        Tablebase tablebase(path);
+        EXPECT_EQ(tablebase.find(uint64_t(0))->value, 1);
+        EXPECT_EQ(tablebase.find(uint64_t(0))->distance, 3);
+    }
+
+    // X wins 3 in a row on a 3x4 board. There are many more states, so the batches are bigger.
+    {
+        MnkSolver::Options options = testOptions(3, 4, 3, "test-MnkSolver-mnk");
+        options.batchSize          = 10000;
+        MnkSolver(options).solve(path);
+        Tablebase tablebase(path);
+        EXPECT_EQ(tablebase.header().rows, 3);
+        EXPECT_EQ(tablebase.header().columns, 4);
+        EXPECT_EQ(tablebase.find(uint64_t(0))->value, 1);
+    }
+
+    // Nobody can make 4 in a row on a 3x4 board
+    {
+        MnkSolver::Options options = testOptions(3, 4, 4, "test-MnkSolver-mnk");
+        options.batchSize          = 10000;
+        MnkSolver(options).solve(path);
+        Tablebase tablebase(path);
+        EXPECT_EQ(tablebase.find(uint64_t(0))->value, 0);
+        EXPECT_EQ(tablebase.find(uint64_t(0))->distance, 12);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(MnkSolver, Resume)
+{
+    MnkSolver::Options options = testOptions(3, 3, 3, "test-MnkSolver-resume");
+    std::string        path    = (std::filesystem::temp_directory_path() / "test-MnkSolver-resume.tb").string();
+    std::string        bad     = (std::filesystem::temp_directory_path() / "test-MnkSolver-missing" / "x.tb").string();
+
+    // The tablebase cannot be written, so the solved levels are left in the work directory
+    EXPECT_THROW(MnkSolver(options).solve(bad), std::runtime_error);
+    EXPECT_TRUE(std::filesystem::exists(options.workDirectory));
+
+    // They belong to a different game
+    MnkSolver::Options other = testOptions(3, 4, 3, "test-MnkSolver-resume");
+    EXPECT_THROW(MnkSolver(other).solve(path), std::runtime_error);
+
+    // Solving again continues from them
+    EXPECT_EQ(MnkSolver(options).solve(path), 5478u);
+    EXPECT_FALSE(std::filesystem::exists(options.workDirectory));
+    std::remove(path.c_str());
+}
+
+TEST(MnkSolver, Invalid)
+{
+    EXPECT_THROW(MnkSolver(testOptions(7, 7, 5, "test-MnkSolver-invalid")), std::runtime_error);
+    EXPECT_THROW(MnkSolver(testOptions(3, 3, 4, "test-MnkSolver-invalid")), std::runtime_error);
+
+    // Only a board with ranks can be solved, since the tablebase could not be played on any other
+    EXPECT_NO_THROW(MnkSolver(testOptions(3, 13, 3, "test-MnkSolver-invalid")));
+    EXPECT_THROW(MnkSolver(testOptions(5, 8, 4, "test-MnkSolver-invalid")), std::runtime_error);
+}
+} // namespace TicTacToe
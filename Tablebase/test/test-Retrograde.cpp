@@ -0,0 +1,92 @@
+#include "gtest/gtest.h"
+
+#include "Components/Board.h"
+#include "Tablebase/Retrograde.h"
+#include "TicTacToeState/TicTacToeState.h"
+
+namespace TicTacToe
+{
+TEST(Retrograde, Solve)
+{
+    std::vector<Tablebase::Entry> entries = Retrograde::solve();
+    ASSERT_EQ(entries.size(), size_t(TicTacToeState::NUMBER_OF_INDEXES));
+
+    // There are 5478 reachable states, and the game is over at 958 of them
+    int reachable = 0;
+    int terminal  = 0;
+    for (Tablebase::Entry const & entry : entries)
+    {
+        if (entry.flags & Tablebase::VALID)
+        {
+            ++reachable;
+            if (entry.bestMove < 0)
+                ++terminal;
+        }
+    }
+    EXPECT_EQ(reachable, 5478);
+    EXPECT_EQ(terminal, 958);
+
+    // The game is a draw, and lasts the whole 9 plies
+    Tablebase::Entry const & start = entries[TicTacToeState().index()];
+    EXPECT_EQ(start.value, 0);
+    EXPECT_EQ(start.distance, 9);
+    EXPECT_GE(start.bestMove, 0);
+}
+
+TEST(Retrograde, Solve_consistent)
+{
+    std::vector<Tablebase::Entry> entries = Retrograde::solve();
+
+    // The best move from every state leads to a state with the opposite value and one ply closer to the end
+    for (int index = 0; index < TicTacToeState::NUMBER_OF_INDEXES; ++index)
+    {
+        Tablebase::Entry const & entry = entries[index];
+        if (!(entry.flags & Tablebase::VALID) || entry.bestMove < 0)
+            continue;
+
+        auto           player = (index % 2 == 0) ? TicTacToeState::PlayerId::ALICE : TicTacToeState::PlayerId::BOB;
+        TicTacToeState state(Board::unrank(index / 2), player);
+        ASSERT_FALSE(state.isDone());
+        ASSERT_EQ(state.board().at(entry.bestMove), Board::Cell::NEITHER);
+        auto [row, column] = Board::toPosition(entry.bestMove);
+        state.move(row, column);
+        Tablebase::Entry const & child = entries[state.index()];
+        ASSERT_TRUE(child.flags & Tablebase::VALID);
+        EXPECT_EQ(child.value, -entry.value);
+        EXPECT_EQ(child.distance + 1, entry.distance);
+    }
+}
+
+TEST(Retrograde, Solve_position)
+{
+    std::vector<Tablebase::Entry> entries = Retrograde::solve();
+
+    // X to move wins at once in the top row
+    {
+        Board board({{
+                        Board::Cell::X,       Board::Cell::X,       Board::Cell::NEITHER,
+                        Board::Cell::O,       Board::Cell::O,       Board::Cell::NEITHER,
+                        Board::Cell::NEITHER, Board::Cell::NEITHER, Board::Cell::NEITHER
+                    }});
+        TicTacToeState           state(board, TicTacToeState::PlayerId::ALICE);
+        Tablebase::Entry const & entry = entries[state.index()];
+        EXPECT_EQ(entry.value, 1);
+        EXPECT_EQ(entry.distance, 1);
+        EXPECT_EQ(entry.bestMove, 2);
+    }
+
+    // X has won, so O has lost
+    {
+        Board board({{
+                        Board::Cell::X,       Board::Cell::X,       Board::Cell::X,
+                        Board::Cell::O,       Board::Cell::O,       Board::Cell::NEITHER,
+                        Board::Cell::NEITHER, Board::Cell::NEITHER, Board::Cell::NEITHER
+                    }});
+        TicTacToeState           state(board, TicTacToeState::PlayerId::BOB);
+        Tablebase::Entry const & entry = entries[state.index()];
+        EXPECT_EQ(entry.value, -1);
+        EXPECT_EQ(entry.distance, 0);
+        EXPECT_EQ(entry.bestMove, -1);
+    }
+}
+} // namespace TicTacToe
@@ -0,0 +1,120 @@
+#include "gtest/gtest.h"
+
+#include "Components/Board.h"
+#include "Tablebase/Retrograde.h"
+#include "Tablebase/Tablebase.h"
+#include "TicTacToeState/TicTacToeState.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+namespace TicTacToe
+{
+// Returns the path of a temporary file for a test
+static std::string temporaryPath(char const * name)
+{
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+TEST(Tablebase, Dense)
+{
+    std::string                   path    = temporaryPath("test-Tablebase-dense.tb");
+    std::vector<Tablebase::Entry> entries = Retrograde::solve();
+    Tablebase::write(path, Tablebase::makeHeader(3, 3, 3, Tablebase::Indexing::DENSE, entries.size()), {}, entries);
+
+    {
+        Tablebase tablebase(path);
+        EXPECT_EQ(tablebase.header().version, Tablebase::VERSION);
+        EXPECT_EQ(tablebase.header().rows, 3);
+        EXPECT_EQ(tablebase.header().columns, 3);
+        EXPECT_EQ(tablebase.header().k, 3);
+        EXPECT_EQ(tablebase.header().indexing, Tablebase::Indexing::DENSE);
+        EXPECT_EQ(tablebase.header().count, entries.size());
+
+        TicTacToeState           state;
+        Tablebase::Entry const * entry = tablebase.find(state);
+        ASSERT_NE(entry, nullptr);
+        EXPECT_EQ(entry->value, 0);
+        EXPECT_EQ(entry->distance, 9);
+
+        // O cannot move first, so the state is not reachable
+        TicTacToeState unreachable(Board(), TicTacToeState::PlayerId::BOB);
+        EXPECT_EQ(tablebase.find(unreachable), nullptr);
+        EXPECT_EQ(tablebase.find(uint64_t(TicTacToeState::NUMBER_OF_INDEXES)), nullptr);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(Tablebase, Sorted)
+{
+    // Store only the reachable states, keyed by the rank of the board
+    std::vector<Tablebase::Entry> solution = Retrograde::solve();
+    std::vector<uint64_t>         keys;
+    std::vector<Tablebase::Entry> entries;
+    for (int index = 0; index < TicTacToeState::NUMBER_OF_INDEXES; ++index)
+    {
+        if (solution[index].flags & Tablebase::VALID)
+        {
+            keys.push_back(uint64_t(index / 2));
+            entries.push_back(solution[index]);
+        }
+    }
+
+    std::string path = temporaryPath("test-Tablebase-sorted.tb");
+    Tablebase::write(path, Tablebase::makeHeader(3, 3, 3, Tablebase::Indexing::SORTED, entries.size()), keys, entries);
+
+    {
+        Tablebase tablebase(path);
+        EXPECT_EQ(tablebase.header().indexing, Tablebase::Indexing::SORTED);
+        EXPECT_EQ(tablebase.header().count, 5478u);
+
+        for (int index = 0; index < TicTacToeState::NUMBER_OF_INDEXES; ++index)
+        {
+            if (solution[index].flags & Tablebase::VALID)
+            {
+                Tablebase::Entry const * entry = tablebase.find(uint64_t(index / 2));
+                ASSERT_NE(entry, nullptr);
+                EXPECT_EQ(entry->value, solution[index].value);
+                EXPECT_EQ(entry->bestMove, solution[index].bestMove);
+            }
+        }
+
+        // A board with two more Xs than Os is not reachable
+        Board board({{
+                        Board::Cell::X,       Board::Cell::X,       Board::Cell::NEITHER,
+                        Board::Cell::NEITHER, Board::Cell::NEITHER, Board::Cell::NEITHER,
+                        Board::Cell::NEITHER, Board::Cell::NEITHER, Board::Cell::NEITHER
+                    }});
+        EXPECT_EQ(tablebase.find(uint64_t(board.rank())), nullptr);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(Tablebase, Invalid)
+{
+    EXPECT_THROW(Tablebase(temporaryPath("test-Tablebase-missing.tb")), std::runtime_error);
+
+    std::string path = temporaryPath("test-Tablebase-invalid.tb");
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "This is not a tablebase, but it is long enough to have a header.";
+    }
+    EXPECT_THROW(Tablebase { path }, std::runtime_error);
+
+    // A table whose entries are cut off
+    std::vector<Tablebase::Entry> entries(10, Tablebase::Entry { 0, 0, -1, Tablebase::VALID });
+    Tablebase::write(path, Tablebase::makeHeader(3, 3, 3, Tablebase::Indexing::DENSE, entries.size()), {}, entries);
+    std::filesystem::resize_file(path, sizeof(Tablebase::Header) + 9 * sizeof(Tablebase::Entry));
+    EXPECT_THROW(Tablebase { path }, std::runtime_error);
+
+    // A table written by a host with the other byte order
+    Tablebase::Header swapped = Tablebase::makeHeader(3, 3, 3, Tablebase::Indexing::DENSE, entries.size());
+    swapped.byteOrder         = 0x0807060504030201;
+    Tablebase::write(path, swapped, {}, entries);
+    EXPECT_THROW(Tablebase { path }, std::runtime_error);
+    std::remove(path.c_str());
+}
+} // namespace TicTacToe
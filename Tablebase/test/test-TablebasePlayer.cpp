@@ -0,0 +1,150 @@
+#include "gtest/gtest.h"
+
+#include "Components/Board.h"
+#include "Tablebase/MnkSolver.h"
+#include "Tablebase/Retrograde.h"
+#include "Tablebase/Tablebase.h"
+#include "Tablebase/TablebasePlayer.h"
+#include "TicTacToeState/TicTacToeState.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace TicTacToe
+{
+class TablebasePlayerTest : public ::testing::Test
+{
+protected:
+    // Each test has its own file, since the tests may be run at the same time by separate processes
+    void SetUp() override
+    {
+        std::string name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        path_            = (std::filesystem::temp_directory_path() / ("test-TablebasePlayer-" + name + ".tb")).string();
+        std::vector<Tablebase::Entry> entries = Retrograde::solve();
+        Tablebase::write(path_, Tablebase::makeHeader(3, 3, 3, Tablebase::Indexing::DENSE, entries.size()), {}, entries);
+        tablebase_ = std::make_shared<Tablebase>(path_);
+    }
+
+    void TearDown() override
+    {
+        tablebase_.reset();
+        std::remove(path_.c_str());
+    }
+
+    std::string                      path_;
+    std::shared_ptr<Tablebase const> tablebase_;
+};
+
+// Plays every possible game in which the opponent moves anywhere, and checks that the player never loses
+static void ExpectNeverLoses(TicTacToeState & state, TablebasePlayer & player)
+{
+    if (state.isDone())
+    {
+        Board::Cell mark = TicTacToeState::toCell(player.playerId());
+        EXPECT_TRUE(state.winner() == mark || state.winner() == Board::Cell::NEITHER);
+        return;
+    }
+
+    if (state.whoseTurn() == player.playerId())
+    {
+        player.move(&state);
+        ExpectNeverLoses(state, player);
+        state.unmove();
+        return;
+    }
+
+    TicTacToeState::MoveList moves;
+    state.generateMoves(&moves);
+    for (TicTacToeState::Move const & move : moves)
+    {
+        state.move(move.row, move.column);
+        ExpectNeverLoses(state, player);
+        state.unmove();
+    }
+}
+
+TEST_F(TablebasePlayerTest, NeverLoses)
+{
+    for (auto id : { TicTacToeState::PlayerId::ALICE, TicTacToeState::PlayerId::BOB })
+    {
+        TablebasePlayer player(id, tablebase_);
+        TicTacToeState  state;
+        ExpectNeverLoses(state, player);
+    }
+}
+
+TEST_F(TablebasePlayerTest, Draw)
+{
+    TablebasePlayer playerX(TicTacToeState::PlayerId::ALICE, tablebase_);
+    TablebasePlayer playerO(TicTacToeState::PlayerId::BOB, tablebase_);
+    TicTacToeState  state;
+    int             plies = 0;
+    while (!state.isDone())
+    {
+        ((state.whoseTurn() == TicTacToeState::PlayerId::ALICE) ? playerX : playerO).move(&state);
+        ++plies;
+    }
+    EXPECT_TRUE(state.isDraw());
+    EXPECT_EQ(plies, 9);
+}
+
+TEST_F(TablebasePlayerTest, Sorted)
+{
+    // A SORTED table of 3 in a row on a 3x4 board, which X wins, is played with the compiled state of that size
+    using State  = BasicTicTacToeState<3, 4, 3>;
+    using Player = BasicTablebasePlayer<State>;
+
+    std::string        path = path_ + ".3x4";
+    MnkSolver::Options options;
+    options.rows          = 3;
+    options.columns       = 4;
+    options.k             = 3;
+    options.workDirectory = (std::filesystem::temp_directory_path() / "test-TablebasePlayer-Sorted").string();
+    MnkSolver(options).solve(path);
+    {
+        auto   tablebase = std::make_shared<Tablebase const>(path);
+        int    distance  = tablebase->find(State())->distance;
+        Player playerX(State::PlayerId::ALICE, tablebase);
+        Player playerO(State::PlayerId::BOB, tablebase);
+        State  state;
+        int    plies = 0;
+        while (!state.isDone())
+        {
+            ((state.whoseTurn() == State::PlayerId::ALICE) ? playerX : playerO).move(&state);
+            ++plies;
+        }
+        EXPECT_EQ(state.winner(), Board::Cell::X);
+        EXPECT_EQ(plies, distance);
+
+        // The 3x3 player cannot use the table
+        EXPECT_THROW(TablebasePlayer(TicTacToeState::PlayerId::ALICE, tablebase), std::runtime_error);
+    }
+    std::remove(path.c_str());
+}
+
+TEST_F(TablebasePlayerTest, WrongSize)
+{
+    // A SORTED table of the empty board for each size, whose best move is a cell that is not on the 3x3 board
+    struct
+    {
+        int rows;
+        int columns;
+        int k;
+    } const sizes[] = { { 4, 4, 4 }, { 3, 4, 3 }, { 3, 3, 2 } };
+    for (auto const & size : sizes)
+    {
+        std::string path = path_ + ".wrong";
+        Tablebase::write(path,
+                         Tablebase::makeHeader(size.rows, size.columns, size.k, Tablebase::Indexing::SORTED, 1),
+                         { 0 },
+                         { { 0, 9, 10, Tablebase::VALID } });
+        auto tablebase = std::make_shared<Tablebase>(path);
+        EXPECT_THROW(TablebasePlayer(TicTacToeState::PlayerId::ALICE, tablebase), std::runtime_error);
+        tablebase.reset();
+        std::remove(path.c_str());
+    }
+}
+} // namespace TicTacToe
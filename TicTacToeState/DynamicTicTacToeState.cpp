@@ -0,0 +1,232 @@
+#include "DynamicTicTacToeState.h"
+
+#include "Components/Tables.h"
+
+#include <cassert>
+
+DynamicTicTacToeState::DynamicTicTacToeState(Board const & board, PlayerId currentPlayer)
+    : board_(board)
+    , currentPlayer_(currentPlayer)
+    , done_(false)
+    , winner_(BoardCell::NEITHER)
+    , fingerprint_((currentPlayer == PlayerId::BOB) ? turnKey() : 0)
+    , lastMove_{BoardCell::NEITHER, -1, -1}
+    , moveCount_(0)
+{
+    for (int i = 0; i < board_.cells(); ++i)
+    {
+        BoardCell cell = board_.at(i);
+        if (cell != BoardCell::NEITHER)
+        {
+            fingerprint_ ^= cellKey(i, cell);
+            ++moveCount_;
+        }
+    }
+    history_.reserve(board_.cells());
+    initializeLines();
+
+    // Initialize done_ and winner_ based on the board state
+    checkIfDone();
+}
+
+void DynamicTicTacToeState::move(int row, int column)
+{
+    // Sanity check - the cell should be empty
+    assert(board_.at(row, column) == BoardCell::NEITHER);
+
+    // The current status is assumed to be not done with no winner
+    assert(!done_);
+    assert(winner_ == BoardCell::NEITHER);
+
+    // Set the cell for the current player
+    BoardCell xo    = toCell(currentPlayer_);
+    int       index = board_.toIndex(row, column);
+    board_.set(index, xo);
+    lastMove_ = { xo, row, column };
+    fingerprint_ ^= cellKey(index, xo);
+    ++moveCount_;
+    history_.push_back(index);
+
+    // Update the lines through the cell. Only these lines can become a win.
+    if (updateLines(index, xo, 1))
+    {
+        winner_ = xo;
+    }
+
+    // Check for win or draw
+    if (winner_ != BoardCell::NEITHER || moveCount_ == board_.cells())
+    {
+        done_ = true;
+    }
+
+    // Switch to the next player
+    currentPlayer_ = (currentPlayer_ == PlayerId::ALICE) ? PlayerId::BOB : PlayerId::ALICE;
+    fingerprint_ ^= turnKey();
+}
+
+void DynamicTicTacToeState::generateMoves(MoveList * pMoves) const
+{
+    pMoves->clear();
+    if (done_)
+    {
+        return;
+    }
+
+    BoardCell xo = toCell(currentPlayer_);
+    for (int i = 0; i < board_.cells(); ++i)
+    {
+        if (board_.at(i) == BoardCell::NEITHER)
+        {
+            auto [row, column] = board_.toPosition(i);
+            pMoves->push_back({ xo, row, column });
+        }
+    }
+}
+
+BoardCell DynamicTicTacToeState::playout(uint64_t * pRandom) const
+{
+    if (done_)
+    {
+        return winner_;
+    }
+
+    // The moves are made on a copy, choosing each one from a list of the empty cells
+    std::vector<int> empty;
+    for (int i = 0; i < board_.cells(); ++i)
+    {
+        if (board_.at(i) == BoardCell::NEITHER)
+            empty.push_back(i);
+    }
+    DynamicTicTacToeState state(*this);
+    while (!state.done_)
+    {
+        size_t choice      = static_cast<size_t>(Tables::splitMix64(*pRandom) % empty.size());
+        auto [row, column] = board_.toPosition(empty[choice]);
+        empty[choice]      = empty.back();
+        empty.pop_back();
+        state.move(row, column);
+    }
+    return state.winner_;
+}
+
+void DynamicTicTacToeState::unmove()
+{
+    assert(!history_.empty());
+
+    int index = history_.back();
+    history_.pop_back();
+    BoardCell xo = board_.at(index);
+    assert(xo != BoardCell::NEITHER);
+
+    // Switch back to the previous player
+    currentPlayer_ = (currentPlayer_ == PlayerId::ALICE) ? PlayerId::BOB : PlayerId::ALICE;
+    fingerprint_ ^= turnKey();
+    assert(xo == toCell(currentPlayer_));
+
+    // A move can only be made while the game is not done, so the game was not done before this move
+    done_   = false;
+    winner_ = BoardCell::NEITHER;
+
+    // Remove the mark
+    updateLines(index, xo, -1);
+    board_.set(index, BoardCell::NEITHER);
+    fingerprint_ ^= cellKey(index, xo);
+    --moveCount_;
+
+    // Restore the previous last move
+    if (!history_.empty())
+    {
+        int previous    = history_.back();
+        auto [row, col] = board_.toPosition(previous);
+        lastMove_       = { board_.at(previous), row, col };
+    }
+    else
+    {
+        lastMove_ = { BoardCell::NEITHER, -1, -1 };
+    }
+}
+
+uint64_t DynamicTicTacToeState::cellKey(int index, BoardCell cell)
+{
+    // The size of the board is not known in advance, so each key is computed when needed from its own SplitMix64 seed
+    uint64_t seed = uint64_t(index) * 2 + ((cell == BoardCell::X) ? 0 : 1);
+    return Tables::splitMix64(seed);
+}
+
+uint64_t DynamicTicTacToeState::turnKey()
+{
+    uint64_t seed = uint64_t(DynamicBoard::MAX_SIZE) * DynamicBoard::MAX_SIZE * 2;
+    return Tables::splitMix64(seed);
+}
+
+void DynamicTicTacToeState::initializeLines()
+{
+    lineCounts_.assign(board_.numberOfLines(), LineCount{ 0, 0 });
+    totals_[0] = totals_[1] = totals_[2] = LineTotals{ 0, 0 };
+    for (int i = 0; i < board_.numberOfLines(); ++i)
+    {
+        for (int index : board_.line(i))
+        {
+            BoardCell cell = board_.at(index);
+            if (cell == BoardCell::X)
+                ++lineCounts_[i].x;
+            else if (cell == BoardCell::O)
+                ++lineCounts_[i].o;
+        }
+        addToTotals(lineCounts_[i], 1);
+    }
+}
+
+void DynamicTicTacToeState::addToTotals(LineCount const & count, int sign)
+{
+    int k = board_.lineLength();
+    if (count.o == 0)
+    {
+        LineTotals & x = totals_[static_cast<int>(BoardCell::X)];
+        x.opens += sign;
+        if (count.x == k - 1)
+            x.twos += sign;
+    }
+    if (count.x == 0)
+    {
+        LineTotals & o = totals_[static_cast<int>(BoardCell::O)];
+        o.opens += sign;
+        if (count.o == k - 1)
+            o.twos += sign;
+    }
+}
+
+bool DynamicTicTacToeState::updateLines(int index, BoardCell cell, int delta)
+{
+    bool completed = false;
+    for (int line : board_.linesThrough(index))
+    {
+        LineCount & count = lineCounts_[line];
+        addToTotals(count, -1);
+        int & n = (cell == BoardCell::X) ? count.x : count.o;
+        n += delta;
+        addToTotals(count, 1);
+        completed = completed || (n == board_.lineLength());
+    }
+    return completed;
+}
+
+void DynamicTicTacToeState::checkIfDone()
+{
+    // Check for a win
+    for (LineCount const & count : lineCounts_)
+    {
+        if (count.x == board_.lineLength() || count.o == board_.lineLength())
+        {
+            done_   = true;
+            winner_ = (count.x == board_.lineLength()) ? BoardCell::X : BoardCell::O;
+            return;
+        }
+    }
+
+    // Check for a draw. If all cells are filled and no winner was found, then it's a draw.
+    if (moveCount_ == board_.cells())
+    {
+        done_ = true;
+    }
+}
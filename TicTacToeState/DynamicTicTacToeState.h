@@ -0,0 +1,136 @@
+#pragma once
+
+#include "Components/DynamicBoard.h"
+#include "GamePlayer/GameState.h"
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+// A tic-tac-toe game state on a board whose size is chosen at run time.
+//
+// It has the same interface as BasicTicTacToeState for playing and searching, but the board is a DynamicBoard, so it is
+// slower. It is used for sizes that do not have a compiled BasicTicTacToeState. There are no ranks or canonical
+// fingerprints.
+class DynamicTicTacToeState : public GamePlayer::GameState
+{
+public:
+    using PlayerId = GamePlayer::GameState::PlayerId;
+    using Board    = DynamicBoard;
+
+    struct Move
+    {
+        BoardCell cell;
+        int       row;
+        int       column;
+    };
+
+    // A list of moves
+    using MoveList = std::vector<Move>;
+
+    // Constructor. Starts the game on the specified board with the specified player to move. The board is assumed to be
+    // valid.
+    explicit DynamicTicTacToeState(Board const & board, PlayerId currentPlayer = PlayerId::ALICE);
+
+    // Destructor
+    virtual ~DynamicTicTacToeState() = default;
+
+    // Make a move for the current player at the specified position. The cell must be empty.
+    void move(int row, int column);
+
+    // Replaces the contents of the list with the legal moves for the current player, in index order. If the game is done,
+    // there are no legal moves.
+    void generateMoves(MoveList * pMoves) const;
+
+    // Plays random moves from this state until the game is over and returns the winner, or NEITHER if it is a draw. The state
+    // is not changed. The random numbers come from a SplitMix64 sequence (see Tables::splitMix64), whose state is advanced.
+    BoardCell playout(uint64_t * pRandom) const;
+
+    // Undo the most recent move made with move(), restoring the state exactly as it was before the move. Marks that were on
+    // the board when the state was constructed cannot be undone.
+    void unmove();
+
+    // Returns true if there is a move that can be undone
+    bool canUnmove() const { return !history_.empty(); }
+
+    // Returns a Zobrist hash of the board and whose turn it is. Overrides GameState::fingerprint().
+    virtual uint64_t fingerprint() const override { return fingerprint_; }
+
+    // Returns the player whose turn it is. Overrides GameState::whoseTurn().
+    virtual PlayerId whoseTurn() const override { return currentPlayer_; }
+
+    // Returns true if the game is over (win or draw)
+    bool isDone() const { return done_; }
+
+    // Returns true if the game is a draw
+    bool isDraw() const { return done_ && winner_ == BoardCell::NEITHER; }
+
+    // Returns the winner
+    BoardCell winner() const { return winner_; }
+
+    // Returns the board
+    Board const & board() const { return board_; }
+
+    // Returns the last move made by the current player
+    Move const & lastMove() const { return lastMove_; }
+
+    // Returns the number of marks on the board
+    int numberOfMoves() const { return moveCount_; }
+
+    // Returns the number of marks of the specified value in the specified line (an index of Board::line())
+    int lineCount(int line, BoardCell cell) const
+    {
+        LineCount const & count = lineCounts_[line];
+        return (cell == BoardCell::X) ? count.x : (cell == BoardCell::O) ? count.o : board_.lineLength() - count.x - count.o;
+    }
+
+    // Returns the number of lines containing all but one of the marks needed to win and an empty cell
+    int twoInLineCount(BoardCell cell) const { return totals_[static_cast<int>(cell)].twos; }
+
+    // Returns the number of lines that can still be completed by the specified player (i.e. without any opposing marks)
+    int openLineCount(BoardCell cell) const { return totals_[static_cast<int>(cell)].opens; }
+
+    // Converts PlayerId to BoardCell
+    static BoardCell toCell(PlayerId player) { return (player == PlayerId::ALICE) ? BoardCell::X : BoardCell::O; }
+
+    // Converts Cell to PlayerId
+    static std::optional<PlayerId> toPlayerId(BoardCell cell)
+    {
+        return (cell == BoardCell::NEITHER) ? std::nullopt :
+               (cell == BoardCell::X)       ? std::optional<PlayerId>(PlayerId::ALICE) :
+                                              std::optional<PlayerId>(PlayerId::BOB);
+    }
+
+private:
+    // Number of Xs and Os in a line
+    struct LineCount
+    {
+        int x;
+        int o;
+    };
+
+    // Number of lines of each kind for a player
+    struct LineTotals
+    {
+        int twos;  // Lines one mark short of a win, with no opposing marks
+        int opens; // Lines with no opposing marks
+    };
+
+    Board                  board_;         // Current board
+    PlayerId               currentPlayer_; // Player to move
+    bool                   done_;          // True if the game is over
+    BoardCell              winner_;        // Cell value of the winner (NEITHER means still playing or done with a draw)
+    uint64_t               fingerprint_;   // Zobrist hash of the board and whose turn it is
+    Move                   lastMove_;      // Last move made
+    int                    moveCount_;     // Number of marks on the board
+    std::vector<int>       history_;       // Indexes of the cells marked by move(), in order
+    std::vector<LineCount> lineCounts_;    // Number of Xs and Os in each line, indexed as Board::line()
+    LineTotals             totals_[3];     // Line totals for each player, indexed by BoardCell (NEITHER is unused)
+
+    static uint64_t cellKey(int index, BoardCell cell);                // Zobrist value of a mark in a cell
+    static uint64_t turnKey();                                         // Zobrist value of Bob's turn
+    void            initializeLines();                                 // Compute the line counts and totals from the board
+    void            addToTotals(LineCount const & count, int sign);    // Add or remove a line's contribution to the totals
+    bool            updateLines(int index, BoardCell cell, int delta); // Update the lines through a cell, true if one is completed
+    void            checkIfDone();                                     // Determine the game status from the line counts
+};
@@ -0,0 +1,171 @@
+#include "QubicState.h"
+
+QubicState::QubicState()
+    : xs_(0)
+    , os_(0)
+    , currentPlayer_(PlayerId::ALICE)
+    , done_(false)
+    , winner_(BoardCell::NEITHER)
+    , zhash_()
+    , lastMove_{BoardCell::NEITHER, -1}
+    , moveCount_(0)
+    , historySize_(0)
+{
+}
+
+QubicState::QubicState(Mask xs, Mask os, PlayerId currentPlayer)
+    : xs_(xs)
+    , os_(os)
+    , currentPlayer_(currentPlayer)
+    , done_(false)
+    , winner_(BoardCell::NEITHER)
+    , zhash_(xs, os, currentPlayer)
+    , lastMove_{BoardCell::NEITHER, -1}
+    , moveCount_(count(xs | os))
+    , historySize_(0)
+{
+    assert((xs & os) == 0);
+
+    // Initialize done_ and winner_ based on the board state, and update the hash accordingly
+    checkIfDone();
+}
+
+void QubicState::move(int index)
+{
+    Mask bit = Mask(1) << index;
+
+    // Sanity check - the cell should be empty
+    assert(((xs_ | os_) & bit) == 0);
+
+    // The current status is assumed to be not done with no winner
+    assert(!done_);
+    assert(winner_ == BoardCell::NEITHER);
+
+    // Set the cell for the current player
+    BoardCell xo    = toCell(currentPlayer_);
+    Mask &    marks = (xo == BoardCell::X) ? xs_ : os_;
+    marks |= bit;
+    lastMove_ = { xo, index };
+    zhash_.move(xo, index);
+    ++moveCount_;
+    assert(historySize_ < CELLS);
+    history_[historySize_++] = static_cast<int8_t>(index);
+
+    // Only the lines through the cell can be completed by the move
+    Geometry::LinesThrough const & through = Geometry::LINES_THROUGH[index];
+    for (int i = 0; i < through.count; ++i)
+    {
+        Mask line = Geometry::LINES[through.lines[i]];
+        if ((marks & line) == line)
+        {
+            winner_ = xo;
+            break;
+        }
+    }
+
+    // Check for win or draw
+    if (winner_ != BoardCell::NEITHER || moveCount_ == CELLS)
+    {
+        done_ = true;
+        zhash_.done(winner_);
+    }
+
+    // Switch to the next player
+    currentPlayer_ = (currentPlayer_ == PlayerId::ALICE) ? PlayerId::BOB : PlayerId::ALICE;
+    zhash_.turn();
+}
+
+void QubicState::generateMoves(MoveList * pMoves) const
+{
+    pMoves->clear();
+    if (done_)
+    {
+        return;
+    }
+
+    BoardCell xo = toCell(currentPlayer_);
+    for (Mask empty = emptyMask(); empty != 0; empty &= empty - 1)
+    {
+        pMoves->push_back({ xo, firstIndex(empty) });
+    }
+}
+
+void QubicState::unmove()
+{
+    assert(historySize_ > 0);
+
+    int       index = history_[--historySize_];
+    Mask      bit   = Mask(1) << index;
+    BoardCell xo    = at(index);
+    assert(xo != BoardCell::NEITHER);
+
+    // Switch back to the previous player
+    currentPlayer_ = (currentPlayer_ == PlayerId::ALICE) ? PlayerId::BOB : PlayerId::ALICE;
+    zhash_.turn();
+    assert(xo == toCell(currentPlayer_));
+
+    // A move can only be made while the game is not done, so the game was not done before this move
+    if (done_)
+    {
+        zhash_.done(winner_);
+        done_   = false;
+        winner_ = BoardCell::NEITHER;
+    }
+
+    // Remove the mark
+    if (xo == BoardCell::X)
+        xs_ &= ~bit;
+    else
+        os_ &= ~bit;
+    zhash_.move(xo, index);
+    --moveCount_;
+
+    // Restore the previous last move
+    if (historySize_ > 0)
+    {
+        int previous = history_[historySize_ - 1];
+        lastMove_    = { at(previous), previous };
+    }
+    else
+    {
+        lastMove_ = { BoardCell::NEITHER, -1 };
+    }
+}
+
+QubicState::Mask QubicState::threats(BoardCell cell) const
+{
+    Mask mine   = mask(cell);
+    Mask theirs = (cell == BoardCell::X) ? os_ : xs_;
+    Mask result = 0;
+    for (Mask line : Geometry::LINES)
+    {
+        if ((theirs & line) == 0 && count(mine & line) == SIZE - 1)
+            result |= line & ~mine;
+    }
+    return result;
+}
+
+void QubicState::checkIfDone()
+{
+    assert(!done_);
+    assert(winner_ == BoardCell::NEITHER);
+
+    // Check for a win
+    for (Mask line : Geometry::LINES)
+    {
+        if ((xs_ & line) == line || (os_ & line) == line)
+        {
+            done_   = true;
+            winner_ = ((xs_ & line) == line) ? BoardCell::X : BoardCell::O;
+            zhash_.done(winner_);
+            return;
+        }
+    }
+
+    // Check for a draw. If all cells are filled and no winner was found, then it's a draw.
+    if (moveCount_ == CELLS)
+    {
+        done_ = true;
+        zhash_.done(winner_);
+    }
+}
@@ -0,0 +1,157 @@
+#pragma once
+
+#include "ZHash.h"
+
+#include "Components/Bits.h"
+#include "Components/Board.h"
+#include "Components/MoveList.h"
+#include "Components/Tables.h"
+#include "GamePlayer/GameState.h"
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <optional>
+
+// A game state for Qubic, which is tic-tac-toe played on a 4x4x4 cube, where 4 marks in a line win.
+//
+// The board is stored as two 64-bit masks, one for the Xs and one for the Os, with bit i corresponding to the cell at index
+// (layer * 4 + row) * 4 + column. After a move, only the 4 or 7 lines through the cell (see Tables::QubicTables) are
+// tested for a win. The game has 76 lines and up to 64 moves per ply, so it is used to measure how a search scales.
+class QubicState : public GamePlayer::GameState
+{
+public:
+    using PlayerId = GamePlayer::GameState::PlayerId;
+    using Geometry = Tables::QubicTables;
+    using Mask     = Geometry::Mask;
+    using ZHash    = QubicZHash;
+
+    // Number of cells on a side
+    static int constexpr SIZE = Geometry::SIZE;
+
+    // Number of cells
+    static int constexpr CELLS = Geometry::CELLS;
+
+    // Number of winning lines
+    static int constexpr NUMBER_OF_LINES = static_cast<int>(Geometry::LINES.size());
+
+    // Mask of all of the cells
+    static Mask constexpr ALL = ~Mask(0);
+
+    struct Move
+    {
+        BoardCell cell;
+        int       index;
+    };
+
+    // A list of moves with a fixed capacity
+    using MoveList = BasicMoveList<Move, CELLS>;
+
+    // Default constructor - creates empty board with Alice to move
+    QubicState();
+
+    // Constructor with specific marks and current player. The marks are assumed to be valid and not to overlap.
+    QubicState(Mask xs, Mask os, PlayerId currentPlayer);
+
+    // Destructor
+    virtual ~QubicState() = default;
+
+    // Make a move for the current player in the cell with the specified index. The cell must be empty.
+    void move(int index);
+
+    // Make a move for the current player at the specified position. The cell must be empty.
+    void move(int layer, int row, int column) { move(toIndex(layer, row, column)); }
+
+    // Replaces the contents of the list with the legal moves for the current player, in index order. If the game is done,
+    // there are no legal moves.
+    void generateMoves(MoveList * pMoves) const;
+
+    // Undo the most recent move made with move(), restoring the state exactly as it was before the move. Moves are undone in
+    // the reverse order that they were made. Marks that were on the board when the state was constructed cannot be undone.
+    void unmove();
+
+    // Returns true if there is a move that can be undone
+    bool canUnmove() const { return historySize_ > 0; }
+
+    // Returns a Zobrist hash of the board, whose turn it is and the game status. Overrides GameState::fingerprint().
+    virtual uint64_t fingerprint() const override { return zhash_.value(); }
+
+    // Returns the player whose turn it is. Overrides GameState::whoseTurn().
+    virtual PlayerId whoseTurn() const override { return currentPlayer_; }
+
+    // Returns true if the game is over (win or draw)
+    bool isDone() const { return done_; }
+
+    // Returns true if the game is a draw
+    bool isDraw() const { return done_ && winner_ == BoardCell::NEITHER; }
+
+    // Returns the winner
+    BoardCell winner() const { return winner_; }
+
+    // Returns the last move made
+    Move const & lastMove() const { return lastMove_; }
+
+    // Returns the number of marks on the board
+    int numberOfMoves() const { return moveCount_; }
+
+    // Returns the value of the cell with the specified index
+    BoardCell at(int index) const
+    {
+        Mask bit = Mask(1) << index;
+        return (xs_ & bit) ? BoardCell::X : (os_ & bit) ? BoardCell::O : BoardCell::NEITHER;
+    }
+
+    // Returns the value of the cell at the specified position
+    BoardCell at(int layer, int row, int column) const { return at(toIndex(layer, row, column)); }
+
+    // Returns the mask of the cells with the specified value
+    Mask mask(BoardCell cell) const
+    {
+        return (cell == BoardCell::X) ? xs_ : (cell == BoardCell::O) ? os_ : emptyMask();
+    }
+
+    // Returns the mask of the empty cells
+    Mask emptyMask() const { return ~(xs_ | os_); }
+
+    // Returns the mask of the empty cells that would complete a line for the specified player
+    Mask threats(BoardCell cell) const;
+
+    // Converts a position to an index
+    static int toIndex(int layer, int row, int column)
+    {
+        assert(layer >= 0 && layer < SIZE && row >= 0 && row < SIZE && column >= 0 && column < SIZE);
+        return (layer * SIZE + row) * SIZE + column;
+    }
+
+    // Returns the index of the lowest cell in the mask. The mask must not be empty.
+    static int firstIndex(Mask mask) { return Bits::firstIndex(mask); }
+
+    // Returns the number of cells in the mask
+    static int count(Mask mask) { return Bits::count(mask); }
+
+    // Converts PlayerId to BoardCell
+    static BoardCell toCell(PlayerId player) { return (player == PlayerId::ALICE) ? BoardCell::X : BoardCell::O; }
+
+    // Converts Cell to PlayerId
+    static std::optional<PlayerId> toPlayerId(BoardCell cell)
+    {
+        return (cell == BoardCell::NEITHER) ? std::nullopt :
+               (cell == BoardCell::X)       ? std::optional<PlayerId>(PlayerId::ALICE) :
+                                              std::optional<PlayerId>(PlayerId::BOB);
+    }
+
+private:
+    Mask      xs_;            // Cells with an X
+    Mask      os_;            // Cells with an O
+    PlayerId  currentPlayer_; // Current player to move
+    bool      done_;          // Indicates if the game is done
+    BoardCell winner_;        // Cell value of the winner (NEITHER means still playing or done with a draw)
+    ZHash     zhash_;         // Zobrist hash for the board state
+    Move      lastMove_;      // The last move made
+    int       moveCount_;     // Number of marks on the board
+    int       historySize_;   // Number of moves that can be undone
+
+    std::array<int8_t, CELLS> history_; // Indexes of the cells marked by move(), in order
+
+    void checkIfDone(); // Determine the game status from the marks
+};
@@ -0,0 +1,3 @@
+#include "SymmetricZHash.h"
+
+template class BasicSymmetricZHash<3, 3, 3>;
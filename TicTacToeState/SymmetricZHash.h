@@ -0,0 +1,124 @@
+#pragma once
+
+#include "ZHash.h"
+
+#include "Components/Board.h"
+#include "GamePlayer/GameState.h"
+
+#include <array>
+
+// Symmetry-canonical Zobrist Hashing Calculator.
+//
+// The board has 8 symmetries (4 if it is not square), and the states related by a symmetry have the same value. This class
+// maintains the Zobrist hash of the state transformed by each of the symmetries, and the canonical value is the smallest of
+// them. All states related by a symmetry have the same canonical value, so a transposition table keyed by it stores one
+// entry for all of them.
+//
+// The symmetry that produces the canonical value maps this state to its canonical form, so a move found for the canonical
+// form maps back to this state with the inverse of the symmetry.
+template <int Rows, int Columns, int K>
+class BasicSymmetricZHash
+{
+public:
+
+    using Board = BasicBoard<Rows, Columns, K>;
+    using ZHash = BasicZHash<Rows, Columns, K>;
+    using Z     = typename ZHash::Z;
+
+    // Constructor
+    BasicSymmetricZHash() = default;
+
+    // Constructor
+    BasicSymmetricZHash(Board const &                   board,
+                        GamePlayer::GameState::PlayerId currentPlayer,
+                        bool                            done = false,
+                        BoardCell                       winner = BoardCell::NEITHER);
+
+    // Returns the canonical value, which is the smallest of the values of the transformed states.
+    Z value() const;
+
+    // Returns the symmetry that transforms the state into its canonical form.
+    int symmetry() const;
+
+    // Returns the value of the state transformed by the specified symmetry.
+    Z value(int symmetry) const { return hashes_[symmetry].value(); }
+
+    // Adds a piece. Returns a reference to itself
+    BasicSymmetricZHash & move(BoardCell cell, int index);
+
+    // Changes whose turn. Returns a reference to itself.
+    BasicSymmetricZHash & turn();
+
+    // Changes from the PLAYING status to the WON or DRAW status.
+    BasicSymmetricZHash & done(BoardCell winner);
+
+private:
+
+    std::array<ZHash, Board::NUMBER_OF_SYMMETRIES> hashes_; // The hash of the state transformed by each symmetry
+};
+
+// The symmetric hash of the 3x3 board
+using SymmetricZHash = BasicSymmetricZHash<3, 3, 3>;
+
+template <int Rows, int Columns, int K>
+BasicSymmetricZHash<Rows, Columns, K>::BasicSymmetricZHash(Board const &                   board,
+                                                           GamePlayer::GameState::PlayerId currentPlayer,
+                                                           bool                            over,
+                                                           BoardCell                       winner)
+{
+    for (int s = 0; s < Board::NUMBER_OF_SYMMETRIES; ++s)
+    {
+        hashes_[s] = ZHash(board.transformed(s), currentPlayer, over, winner);
+    }
+}
+
+template <int Rows, int Columns, int K>
+auto BasicSymmetricZHash<Rows, Columns, K>::value() const -> Z
+{
+    return hashes_[symmetry()].value();
+}
+
+template <int Rows, int Columns, int K>
+int BasicSymmetricZHash<Rows, Columns, K>::symmetry() const
+{
+    int best = 0;
+    for (int s = 1; s < Board::NUMBER_OF_SYMMETRIES; ++s)
+    {
+        if (hashes_[s] < hashes_[best])
+            best = s;
+    }
+    return best;
+}
+
+template <int Rows, int Columns, int K>
+BasicSymmetricZHash<Rows, Columns, K> & BasicSymmetricZHash<Rows, Columns, K>::move(BoardCell cell, int index)
+{
+    for (int s = 0; s < Board::NUMBER_OF_SYMMETRIES; ++s)
+    {
+        hashes_[s].move(cell, Board::transform(index, s));
+    }
+    return *this;
+}
+
+template <int Rows, int Columns, int K>
+BasicSymmetricZHash<Rows, Columns, K> & BasicSymmetricZHash<Rows, Columns, K>::turn()
+{
+    for (ZHash & hash : hashes_)
+    {
+        hash.turn();
+    }
+    return *this;
+}
+
+template <int Rows, int Columns, int K>
+BasicSymmetricZHash<Rows, Columns, K> & BasicSymmetricZHash<Rows, Columns, K>::done(BoardCell winner)
+{
+    for (ZHash & hash : hashes_)
+    {
+        hash.done(winner);
+    }
+    return *this;
+}
+
+// The 3x3 symmetric hash is compiled once, in SymmetricZHash.cpp
+extern template class BasicSymmetricZHash<3, 3, 3>;
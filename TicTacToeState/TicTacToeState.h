@@ -1,44 +1,107 @@
 #pragma once
 
 #include "Components/Board.h"
+#include "Components/MoveList.h"
 #include "GamePlayer/GameState.h"
+#include "SymmetricZHash.h"
 #include "ZHash.h"
 
 #include <array>
+#include <cassert>
 #include <cstdint>
 #include <memory>
 #include <optional>
 #include <utility>
 #include <vector>
 
-// A tic-tac-toe game state.
-
-class TicTacToeState : public GamePlayer::GameState
+// A tic-tac-toe game state, on a board with Rows rows and Columns columns on which K marks in a line win.
+//
+// The size is fixed at compile time, so every table and array is sized for it. The 3x3 game is TicTacToeState.
+template <int Rows, int Columns, int K>
+class BasicTicTacToeState : public GamePlayer::GameState
 {
 public:
-    using PlayerId = GamePlayer::GameState::PlayerId;
+    using PlayerId       = GamePlayer::GameState::PlayerId;
+    using Board          = BasicBoard<Rows, Columns, K>;
+    using ZHash          = BasicZHash<Rows, Columns, K>;
+    using SymmetricZHash = BasicSymmetricZHash<Rows, Columns, K>;
+    using Mask           = typename Board::Mask;
+    using Rank           = typename Board::Rank;
+
     struct Move
     {
-        Board::Cell cell;
-        int         row;
-        int         column;
+        BoardCell cell;
+        int       row;
+        int       column;
     };
 
+    // A list of moves with a fixed capacity
+    using MoveList = BasicMoveList<Move, Board::CELLS>;
+
     // Default constructor - creates empty board with Alice to move
-    TicTacToeState();
+    BasicTicTacToeState();
 
     // Constructor with specific board state and current player. The board is assued to be valid.
-    TicTacToeState(Board const & board, PlayerId currentPlayer);
+    BasicTicTacToeState(Board const & board, PlayerId currentPlayer);
 
     // Destructor
-    virtual ~TicTacToeState() = default;
+    virtual ~BasicTicTacToeState() = default;
 
     // Make a move for the current player at the specified position. The cell must be empty.
     void move(int row, int column);
 
-    // Returns a fingerprint for this state. Overrides GameState::fingerprint().
+    // Replaces the contents of the list with the legal moves for the current player, in index order. If the game is done,
+    // there are no legal moves.
+    void generateMoves(MoveList * pMoves) const;
+
+    // Plays random moves from this state until the game is over and returns the winner, or NEITHER if it is a draw. The state
+    // is not changed. The playout only updates a pair of bitboards, so it is much faster than making the moves. The random
+    // numbers come from a SplitMix64 sequence (see Tables::splitMix64), whose state is advanced.
+    BoardCell playout(uint64_t * pRandom) const;
+
+    // Undo the most recent move made with move(), restoring the state exactly as it was before the move. Moves are undone in
+    // the reverse order that they were made. Marks that were on the board when the state was constructed cannot be undone.
+    void unmove();
+
+    // Returns true if there is a move that can be undone
+    bool canUnmove() const { return historySize_ > 0; }
+
+    // Returns a fingerprint for this state. Overrides GameState::fingerprint(). If canonical fingerprints are enabled, all
+    // states related by a symmetry of the board have the same fingerprint.
     virtual uint64_t fingerprint() const override;
 
+    // Enables or disables canonical fingerprints. When enabled, the Zobrist values of the symmetric forms of the state are
+    // maintained, and fingerprint() returns the smallest. Copies of the state inherit the setting.
+    void useCanonicalFingerprint(bool enable);
+
+    // Returns true if canonical fingerprints are enabled
+    bool usesCanonicalFingerprint() const { return canonical_; }
+
+    // Returns the symmetry (see Board::SYMMETRIES) that transforms this state into its canonical form. A cell index in the
+    // canonical form maps back to this state with Board::transform(index, Board::inverse(canonicalSymmetry())). Canonical
+    // fingerprints must be enabled.
+    int canonicalSymmetry() const
+    {
+        assert(canonical_);
+        return symmetricZHash_.symmetry();
+    }
+
+    // Returns the rank of the board (see Board::rank()). Unlike the fingerprint, the rank is a dense, collision-free index, but
+    // it does not include whose turn it is or the game status. For states reached by play from the initial state, whose
+    // turn it is and the game status are determined by the board. The board must have ranks.
+    Rank rank() const
+    {
+        static_assert(Board::HAS_RANKS, "The ranks of the board do not fit in 64 bits");
+        return rank_;
+    }
+
+    // Number of distinct values of index()
+    static Rank constexpr NUMBER_OF_INDEXES = 2 * Board::NUMBER_OF_RANKS;
+
+    // Returns a dense, collision-free index of the board and whose turn it is, in the range [0, NUMBER_OF_INDEXES). The
+    // board must have ranks.
+    Rank index() const { return rank() * 2 + (currentPlayer_ == PlayerId::ALICE ? 0 : 1); }
+
     // Returns the player whose turn it is. Overrides GameState::whoseTurn().
     virtual PlayerId whoseTurn() const override { return currentPlayer_; }
 
@@ -46,10 +109,10 @@ public:
     bool isDone() const { return done_; }
 
     // Returns true if the game is a draw
-    bool isDraw() const { return done_ && winner_ == Board::Cell::NEITHER; }
+    bool isDraw() const { return done_ && winner_ == BoardCell::NEITHER; }
 
     // Returns the winner
-    Board::Cell winner() const { return winner_; }
+    BoardCell winner() const { return winner_; }
 
     // Returns the board
     Board const & board() const { return board_; }
@@ -57,24 +120,364 @@ public:
     // Returns the last move made by the current player
     Move const & lastMove() const { return lastMove_; }
 
-    // Converts PlayerId to Board::Cell
-    static Board::Cell toCell(PlayerId player) { return (player == PlayerId::ALICE) ? Board::Cell::X : Board::Cell::O; }
+    // Returns the number of marks on the board
+    int numberOfMoves() const { return moveCount_; }
+
+    // Returns the number of marks of the specified value in the specified line (an index into Board::LINES)
+    int lineCount(int line, BoardCell cell) const
+    {
+        LineCount const & count = lineCounts_[line];
+        return (cell == BoardCell::X) ? count.x : (cell == BoardCell::O) ? count.o : K - count.x - count.o;
+    }
+
+    // Returns the number of lines containing all but one of the marks needed to win (two on the 3x3 board) and an empty cell
+    int twoInLineCount(BoardCell cell) const { return totals_[static_cast<int>(cell)].twos; }
+
+    // Returns the number of lines that can still be completed by the specified player (i.e. without any opposing marks)
+    int openLineCount(BoardCell cell) const { return totals_[static_cast<int>(cell)].opens; }
+
+    // Converts PlayerId to BoardCell
+    static BoardCell toCell(PlayerId player) { return (player == PlayerId::ALICE) ? BoardCell::X : BoardCell::O; }
 
     // Converts Cell to PlayerId
-    static std::optional<PlayerId> toPlayerId(Board::Cell cell)
+    static std::optional<PlayerId> toPlayerId(BoardCell cell)
     {
-        return (cell == Board::Cell::NEITHER) ? std::nullopt :
-               (cell == Board::Cell::X)       ? std::optional<PlayerId>(PlayerId::ALICE) :
-                                                std::optional<PlayerId>(PlayerId::BOB);
+        return (cell == BoardCell::NEITHER) ? std::nullopt :
+               (cell == BoardCell::X)       ? std::optional<PlayerId>(PlayerId::ALICE) :
+                                              std::optional<PlayerId>(PlayerId::BOB);
     }
 
 private:
-    Board       board_;         // Board stored in row-major order
-    PlayerId    currentPlayer_; // Current player to move
-    bool        done_;          // Indicates if the game is done
-    Board::Cell winner_;        // Cell value of the winner (NEITHER means still playing or done with a draw)
-    ZHash       zhash_;         // Zobrist hash for the board state
-    Move        lastMove_;      // The last move made by the current player
-
-    void checkIfDone(); // Determine the game status after a move
+    // Number of Xs and Os in a line
+    struct LineCount
+    {
+        uint8_t x;
+        uint8_t o;
+    };
+
+    // Number of lines of each kind for a player
+    struct LineTotals
+    {
+        uint8_t twos;
+        uint8_t opens;
+    };
+
+    Board          board_;          // Board stored in row-major order
+    PlayerId       currentPlayer_;  // Current player to move
+    bool           done_;           // Indicates if the game is done
+    BoardCell      winner_;         // Cell value of the winner (NEITHER means still playing or done with a draw)
+    ZHash          zhash_;          // Zobrist hash for the board state
+    Move           lastMove_;       // The last move made by the current player
+    int            moveCount_;      // Number of marks on the board
+    int            historySize_;    // Number of moves that can be undone
+    Rank           rank_;           // Rank of the board (only if the board has ranks)
+    bool           canonical_;      // True if canonical fingerprints are enabled
+    SymmetricZHash symmetricZHash_; // Zobrist hashes of the symmetric forms of the state (only if canonical_ is true)
+
+    std::array<int8_t, Board::CELLS>              history_;    // Indexes of the cells marked by move(), in order
+    std::array<LineCount, Board::NUMBER_OF_LINES> lineCounts_; // Number of Xs and Os in each line, indexed as Board::LINES
+    std::array<LineTotals, 3>                     totals_;     // Line totals for each player, indexed by BoardCell
+
+    static Rank initialRank(Board const & board);                  // The rank of a board, or 0 if the board has no ranks
+    void        initializeLines();                                 // Compute the line counts and totals from the board
+    void        addToTotals(LineCount const & count, int sign);    // Add or remove a line's contribution to the totals
+    bool        updateLines(int index, BoardCell cell, int delta); // Update the lines through a cell, true if one is completed
+    void        checkIfDone();                                     // Determine the game status from the line counts
 };
+
+// The 3x3 game state
+using TicTacToeState = BasicTicTacToeState<3, 3, 3>;
+
+template <int Rows, int Columns, int K>
+BasicTicTacToeState<Rows, Columns, K>::BasicTicTacToeState()
+    : board_()
+    , currentPlayer_(PlayerId::ALICE)
+    , done_(false)
+    , winner_(BoardCell::NEITHER)
+    , zhash_()
+    , lastMove_{BoardCell::NEITHER, -1, -1}
+    , moveCount_(0)
+    , historySize_(0)
+    , rank_(0)
+    , canonical_(false)
+{
+    initializeLines();
+}
+
+template <int Rows, int Columns, int K>
+BasicTicTacToeState<Rows, Columns, K>::BasicTicTacToeState(Board const & board, PlayerId currentPlayer)
+    : board_(board)
+    , currentPlayer_(currentPlayer)
+    , done_(false)
+    , winner_(BoardCell::NEITHER)
+    , zhash_(board, currentPlayer)
+    , lastMove_{BoardCell::NEITHER, -1, -1}
+    , moveCount_(Board::count(Board::ALL & ~board.emptyMask()))
+    , historySize_(0)
+    , rank_(initialRank(board))
+    , canonical_(false)
+{
+    initializeLines();
+
+    // Initialize done_ and winner_ based on the board state, and update the hash accordingly
+    checkIfDone();
+}
+
+template <int Rows, int Columns, int K>
+uint64_t BasicTicTacToeState<Rows, Columns, K>::fingerprint() const
+{
+    return canonical_ ? symmetricZHash_.value() : zhash_.value();
+}
+
+template <int Rows, int Columns, int K>
+void BasicTicTacToeState<Rows, Columns, K>::useCanonicalFingerprint(bool enable)
+{
+    if (enable && !canonical_)
+    {
+        symmetricZHash_ = SymmetricZHash(board_, currentPlayer_, done_, winner_);
+    }
+    canonical_ = enable;
+}
+
+template <int Rows, int Columns, int K>
+void BasicTicTacToeState<Rows, Columns, K>::move(int row, int column)
+{
+    // Sanity check - the cell should be empty
+    assert(board_.at(row, column) == BoardCell::NEITHER);
+
+    // The current status is assumed to be not done with no winner
+    assert(!done_);
+    assert(winner_ == BoardCell::NEITHER);
+
+    // Set the cell for the current player
+    BoardCell xo    = toCell(currentPlayer_);
+    int       index = Board::toIndex(row, column);
+    board_.set(index, xo);
+    lastMove_ = { xo, row, column };
+    zhash_.move(xo, index);
+    if (canonical_)
+        symmetricZHash_.move(xo, index);
+    if constexpr (Board::HAS_RANKS)
+        rank_ += Board::rankOf(xo, index);
+    ++moveCount_;
+    assert(historySize_ < Board::CELLS);
+    history_[historySize_++] = static_cast<int8_t>(index);
+
+    // Update the lines through the cell. Only these lines can become a win.
+    if (updateLines(index, xo, 1))
+    {
+        winner_ = xo;
+    }
+
+    // Check for win or draw
+    if (winner_ != BoardCell::NEITHER || moveCount_ == Board::CELLS)
+    {
+        done_ = true;
+        zhash_.done(winner_);
+        if (canonical_)
+            symmetricZHash_.done(winner_);
+    }
+
+    // Switch to the next player
+    currentPlayer_ = (currentPlayer_ == PlayerId::ALICE) ? PlayerId::BOB : PlayerId::ALICE;
+    zhash_.turn();
+    if (canonical_)
+        symmetricZHash_.turn();
+}
+
+template <int Rows, int Columns, int K>
+void BasicTicTacToeState<Rows, Columns, K>::generateMoves(MoveList * pMoves) const
+{
+    pMoves->clear();
+    if (done_)
+    {
+        return;
+    }
+
+    BoardCell xo = toCell(currentPlayer_);
+    for (Mask empty = board_.emptyMask(); empty != 0; empty &= empty - 1)
+    {
+        auto [row, column] = Board::toPosition(Board::firstIndex(empty));
+        pMoves->push_back({ xo, row, column });
+    }
+}
+
+template <int Rows, int Columns, int K>
+BoardCell BasicTicTacToeState<Rows, Columns, K>::playout(uint64_t * pRandom) const
+{
+    if (done_)
+    {
+        return winner_;
+    }
+
+    std::array<Mask, 2> marks  = { board_.mask(BoardCell::X), board_.mask(BoardCell::O) };
+    Mask                empty  = board_.emptyMask();
+    int                 player = (currentPlayer_ == PlayerId::ALICE) ? 0 : 1;
+    while (empty != 0)
+    {
+        // Choose a random empty cell. The bias of the modulo is negligible for so few cells.
+        int  skip      = static_cast<int>(Tables::splitMix64(*pRandom) % Board::count(empty));
+        Mask remaining = empty;
+        for (; skip > 0; --skip)
+        {
+            remaining &= remaining - 1;
+        }
+        int  index = Board::firstIndex(remaining);
+        Mask bit   = Mask(Mask(1) << index);
+        marks[player] |= bit;
+        empty &= ~bit;
+
+        // Only the lines through the cell can be completed by the move
+        typename Board::LinesThrough const & through = Board::LINES_THROUGH[index];
+        for (int i = 0; i < through.count; ++i)
+        {
+            Mask line = Board::LINES[through.lines[i]];
+            if ((marks[player] & line) == line)
+                return (player == 0) ? BoardCell::X : BoardCell::O;
+        }
+        player ^= 1;
+    }
+    return BoardCell::NEITHER;
+}
+
+template <int Rows, int Columns, int K>
+void BasicTicTacToeState<Rows, Columns, K>::unmove()
+{
+    assert(historySize_ > 0);
+
+    int       index = history_[--historySize_];
+    BoardCell xo    = board_.at(index);
+    assert(xo != BoardCell::NEITHER);
+
+    // Switch back to the previous player
+    currentPlayer_ = (currentPlayer_ == PlayerId::ALICE) ? PlayerId::BOB : PlayerId::ALICE;
+    zhash_.turn();
+    if (canonical_)
+        symmetricZHash_.turn();
+    assert(xo == toCell(currentPlayer_));
+
+    // A move can only be made while the game is not done, so the game was not done before this move
+    if (done_)
+    {
+        zhash_.done(winner_);
+        if (canonical_)
+            symmetricZHash_.done(winner_);
+        done_   = false;
+        winner_ = BoardCell::NEITHER;
+    }
+
+    // Remove the mark
+    updateLines(index, xo, -1);
+    board_.set(index, BoardCell::NEITHER);
+    zhash_.move(xo, index);
+    if (canonical_)
+        symmetricZHash_.move(xo, index);
+    if constexpr (Board::HAS_RANKS)
+        rank_ -= Board::rankOf(xo, index);
+    --moveCount_;
+
+    // Restore the previous last move
+    if (historySize_ > 0)
+    {
+        int previous    = history_[historySize_ - 1];
+        auto [row, col] = Board::toPosition(previous);
+        lastMove_       = { board_.at(previous), row, col };
+    }
+    else
+    {
+        lastMove_ = { BoardCell::NEITHER, -1, -1 };
+    }
+}
+
+template <int Rows, int Columns, int K>
+auto BasicTicTacToeState<Rows, Columns, K>::initialRank(Board const & board) -> Rank
+{
+    if constexpr (Board::HAS_RANKS)
+        return board.rank();
+    else
+        return 0;
+}
+
+template <int Rows, int Columns, int K>
+void BasicTicTacToeState<Rows, Columns, K>::initializeLines()
+{
+    Mask xs = board_.mask(BoardCell::X);
+    Mask os = board_.mask(BoardCell::O);
+    totals_ = {};
+    for (int i = 0; i < Board::NUMBER_OF_LINES; ++i)
+    {
+        lineCounts_[i] = { uint8_t(Board::count(xs & Board::LINES[i])), uint8_t(Board::count(os & Board::LINES[i])) };
+        addToTotals(lineCounts_[i], 1);
+    }
+}
+
+template <int Rows, int Columns, int K>
+void BasicTicTacToeState<Rows, Columns, K>::addToTotals(LineCount const & count, int sign)
+{
+    if (count.o == 0)
+    {
+        LineTotals & x = totals_[static_cast<int>(BoardCell::X)];
+        x.opens += sign;
+        if (count.x == K - 1)
+            x.twos += sign;
+    }
+    if (count.x == 0)
+    {
+        LineTotals & o = totals_[static_cast<int>(BoardCell::O)];
+        o.opens += sign;
+        if (count.o == K - 1)
+            o.twos += sign;
+    }
+}
+
+template <int Rows, int Columns, int K>
+bool BasicTicTacToeState<Rows, Columns, K>::updateLines(int index, BoardCell cell, int delta)
+{
+    bool                                 completed = false;
+    typename Board::LinesThrough const & through   = Board::LINES_THROUGH[index];
+    for (int i = 0; i < through.count; ++i)
+    {
+        LineCount & count = lineCounts_[through.lines[i]];
+        addToTotals(count, -1);
+        uint8_t & n = (cell == BoardCell::X) ? count.x : count.o;
+        n += delta;
+        addToTotals(count, 1);
+        completed = completed || (n == K);
+    }
+    return completed;
+}
+
+template <int Rows, int Columns, int K>
+void BasicTicTacToeState<Rows, Columns, K>::checkIfDone()
+{
+    if (done_)
+    {
+        // If the game is already done, no need to check again
+        return;
+    }
+
+    assert(winner_ == BoardCell::NEITHER);
+
+    // Check for a win
+    for (LineCount const & count : lineCounts_)
+    {
+        if (count.x == K || count.o == K)
+        {
+            done_   = true;
+            winner_ = (count.x == K) ? BoardCell::X : BoardCell::O;
+            zhash_.done(winner_);
+            return;
+        }
+    }
+
+    // Check for a draw. If all cells are filled and no winner was found, then it's a draw. Set the game as done and leave
+    // the winner as NEITHER.
+    if (moveCount_ == Board::CELLS)
+    {
+        done_ = true;
+        zhash_.done(winner_);
+    }
+}
+
+// The 3x3 game state is compiled once, in TicTacToeState.cpp
+extern template class BasicTicTacToeState<3, 3, 3>;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Components/Board.h"
+#include "Components/Tables.h"
 #include "GamePlayer/GameState.h"
 
 #include <cstdint>
@@ -18,10 +19,17 @@
 //      3. The current status of the game (whether it is still playing) and the winner (if any)
 //
 // An important characteristic of a Zorbrist hash is that it is independent of the order of the changes made to reach the state.
-class ZHash
+//
+// The keys are generated for each board (see Tables::BasicTables and Tables::QubicTables), and the hash is a template on its
+// key table, so every board shares this implementation. The hash of the 3x3 board is ZHash.
+template <typename Keys>
+class KeyedZHash
 {
 public:
 
+    // A set of cells
+    using Mask = typename Keys::Mask;
+
     // Type of a hash value
     using Z = std::uint64_t;
 
@@ -32,70 +40,102 @@ public:
     static Z constexpr UNDEFINED = ~EMPTY;
 
     // Constructor
-    explicit ZHash(Z z = EMPTY)
+    explicit KeyedZHash(Z z = EMPTY)
         : value_(z)
     {
     }
 
     // Constructor
-    ZHash(Board const &                   board,
-          GamePlayer::GameState::PlayerId currentPlayer,
-          bool                            done = false,
-          Board::Cell                     winner = Board::Cell::NEITHER);
+    KeyedZHash(Mask                            xs,
+               Mask                            os,
+               GamePlayer::GameState::PlayerId currentPlayer,
+               bool                            done = false,
+               BoardCell                       winner = BoardCell::NEITHER);
+
+    // Constructor. The board must have the cells of the key table.
+    template <typename Board>
+    KeyedZHash(Board const &                   board,
+               GamePlayer::GameState::PlayerId currentPlayer,
+               bool                            done = false,
+               BoardCell                       winner = BoardCell::NEITHER)
+        : KeyedZHash(board.mask(BoardCell::X), board.mask(BoardCell::O), currentPlayer, done, winner)
+    {
+        static_assert(Board::CELLS == Keys::CELLS, "The board does not have the cells of the key table");
+    }
 
     // Returns the current value.
     Z value() const { return value_; }
 
     // Adds a piece. Returns a reference to itself
-    ZHash & move(Board::Cell cell, int index);
+    KeyedZHash & move(BoardCell cell, int index)
+    {
+        value_ ^= Keys::ZOBRIST_KEYS.cells[index][static_cast<int>(cell)];
+        return *this;
+    }
 
     // Changes whose turn. Returns a reference to itself.
-    ZHash & turn();
+    KeyedZHash & turn()
+    {
+        value_ ^= Keys::ZOBRIST_KEYS.turn;
+        return *this;
+    }
 
     // Changes from the PLAYING status to the WON or DRAW status.
-    ZHash & done(Board::Cell winner);
+    KeyedZHash & done(BoardCell winner)
+    {
+        value_ ^= Keys::ZOBRIST_KEYS.winners[static_cast<int>(winner)];
+        return *this;
+    }
 
     // Returns true if the value is undefined (i.e. not a legal Z value)
     bool isUndefined() const { return value_ == UNDEFINED; }
 
-private:
+    // Equality operator
+    friend bool operator ==(KeyedZHash const & x, KeyedZHash const & y) { return x.value_ == y.value_; }
 
-    friend bool operator ==(ZHash const & x, ZHash const & y);
-    friend bool operator <(ZHash const & x, ZHash const & y);
+    // Less than operator
+    friend bool operator <(KeyedZHash const & x, KeyedZHash const & y) { return x.value_ < y.value_; }
 
-    class ZValueTable;                     // declared below
+private:
 
     Z value_;                              // The hash value
-
-    static ZValueTable const zValueTable_; // The hash values for each incremental state change
 };
 
-// Equality operator
-inline bool operator ==(ZHash const & x, ZHash const & y)
-{
-    return x.value_ == y.value_;
-}
+// The hash of a board of any size
+template <int Rows, int Columns, int K>
+using BasicZHash = KeyedZHash<Tables::BasicTables<Rows, Columns, K>>;
 
-// Less than operator
-inline bool operator <(ZHash const & x, ZHash const & y)
-{
-    return x.value_ < y.value_;
-}
+// The hash of the 3x3 board
+using ZHash = BasicZHash<3, 3, 3>;
 
-class ZHash::ZValueTable
-{
-public:
+// The hash of the 4x4x4 cube of Qubic
+using QubicZHash = KeyedZHash<Tables::QubicTables>;
 
-    ZValueTable();
+template <typename Keys>
+KeyedZHash<Keys>::KeyedZHash(Mask xs, Mask os, GamePlayer::GameState::PlayerId currentPlayer, bool over, BoardCell winner)
+    : value_(EMPTY)
+{
+    // Initialize the hash with the board state
+    for (int i = 0; i < Keys::CELLS; ++i)
+    {
+        Mask bit = Mask(1) << i;
+        if (xs & bit)
+            move(BoardCell::X, i);
+        else if (os & bit)
+            move(BoardCell::O, i);
+    }
 
-    Z cellValue(Board::Cell cell, int row, int column) const { return cellValue(cell, Board::toIndex(row, column)); }
-    Z cellValue(Board::Cell cell, int index) const { return cellValues_[index][static_cast<int>(cell)]; }
-    Z turnValue() const { return turnValue_; }
-    Z winnerValue(Board::Cell winner) const { return winnerValues_[static_cast<int>(winner)]; }
+    // Add the current player
+    if (currentPlayer != GamePlayer::GameState::PlayerId::ALICE)
+        turn();
 
-private:
+    // If the game is over, add the done status and winner
+    if (over)
+    {
+        done(winner);
+    }
+}
 
-    Z cellValues_[9][3];
-    Z turnValue_;
-    Z winnerValues_[3];
-};
+// The 3x3 and Qubic hashes are compiled once, in ZHash.cpp
+extern template class KeyedZHash<Tables::TicTacToeTables>;
+extern template class KeyedZHash<Tables::QubicTables>;
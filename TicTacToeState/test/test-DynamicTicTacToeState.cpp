@@ -0,0 +1,157 @@
+#include "gtest/gtest.h"
+
+#include "Components/Tables.h"
+#include "TicTacToeState/DynamicTicTacToeState.h"
+#include "TicTacToeState/TicTacToeState.h"
+
+namespace TicTacToe
+{
+// Plays the same random games with a compiled state and a dynamic state of the same size, and checks that they agree
+template <int Rows, int Columns, int K>
+static void compareWithCompiled(uint64_t seed)
+{
+    using State = BasicTicTacToeState<Rows, Columns, K>;
+    State                 compiled;
+    DynamicTicTacToeState dynamic(DynamicBoard(Rows, Columns, K));
+    uint64_t              random = seed;
+    while (!compiled.isDone())
+    {
+        ASSERT_FALSE(dynamic.isDone());
+        typename State::MoveList        moves;
+        DynamicTicTacToeState::MoveList dynamicMoves;
+        compiled.generateMoves(&moves);
+        dynamic.generateMoves(&dynamicMoves);
+        ASSERT_EQ(static_cast<int>(dynamicMoves.size()), moves.size());
+
+        auto const & move = moves[static_cast<int>(Tables::splitMix64(random) % moves.size())];
+        compiled.move(move.row, move.column);
+        dynamic.move(move.row, move.column);
+        EXPECT_EQ(dynamic.whoseTurn(), compiled.whoseTurn());
+        EXPECT_EQ(dynamic.numberOfMoves(), compiled.numberOfMoves());
+        for (BoardCell cell : { BoardCell::X, BoardCell::O })
+        {
+            EXPECT_EQ(dynamic.twoInLineCount(cell), compiled.twoInLineCount(cell));
+            EXPECT_EQ(dynamic.openLineCount(cell), compiled.openLineCount(cell));
+        }
+    }
+    EXPECT_TRUE(dynamic.isDone());
+    EXPECT_EQ(dynamic.winner(), compiled.winner());
+    EXPECT_EQ(dynamic.isDraw(), compiled.isDraw());
+}
+
+TEST(DynamicTicTacToeState, Constructor)
+{
+    DynamicTicTacToeState state(DynamicBoard(4, 5, 3));
+    EXPECT_EQ(state.whoseTurn(), DynamicTicTacToeState::PlayerId::ALICE);
+    EXPECT_FALSE(state.isDone());
+    EXPECT_EQ(state.numberOfMoves(), 0);
+    EXPECT_FALSE(state.canUnmove());
+    EXPECT_EQ(state.lastMove().cell, BoardCell::NEITHER);
+
+    // A board that is already won
+    DynamicBoard board(4, 5, 3);
+    board.set(0, 0, BoardCell::X);
+    board.set(1, 1, BoardCell::X);
+    board.set(2, 2, BoardCell::X);
+    board.set(0, 4, BoardCell::O);
+    board.set(1, 4, BoardCell::O);
+    DynamicTicTacToeState won(board, DynamicTicTacToeState::PlayerId::BOB);
+    EXPECT_TRUE(won.isDone());
+    EXPECT_EQ(won.winner(), BoardCell::X);
+    EXPECT_EQ(won.numberOfMoves(), 5);
+    EXPECT_NE(won.fingerprint(), state.fingerprint());
+}
+
+TEST(DynamicTicTacToeState, CompareWithCompiled)
+{
+    for (uint64_t seed = 0; seed < 50; ++seed)
+    {
+        compareWithCompiled<3, 3, 3>(seed);
+        compareWithCompiled<3, 4, 3>(seed);
+        compareWithCompiled<4, 4, 4>(seed);
+        compareWithCompiled<7, 7, 4>(seed);
+    }
+}
+
+TEST(DynamicTicTacToeState, Unmove)
+{
+    DynamicTicTacToeState state(DynamicBoard(5, 5, 4));
+    uint64_t              fingerprint = state.fingerprint();
+
+    // X wins down the first column
+    for (int r = 0; r < 3; ++r)
+    {
+        state.move(r, 0);
+        state.move(r, 1);
+    }
+    uint64_t beforeWin = state.fingerprint();
+    state.move(3, 0);
+    EXPECT_TRUE(state.isDone());
+    EXPECT_EQ(state.winner(), BoardCell::X);
+    EXPECT_EQ(state.lastMove().row, 3);
+
+    state.unmove();
+    EXPECT_FALSE(state.isDone());
+    EXPECT_EQ(state.winner(), BoardCell::NEITHER);
+    EXPECT_EQ(state.fingerprint(), beforeWin);
+    EXPECT_EQ(state.lastMove().column, 1);
+    EXPECT_EQ(state.twoInLineCount(BoardCell::X), 1); // The column from (0, 0) to (3, 0)
+
+    while (state.canUnmove())
+    {
+        state.unmove();
+    }
+    EXPECT_EQ(state.fingerprint(), fingerprint);
+    EXPECT_EQ(state.numberOfMoves(), 0);
+    EXPECT_EQ(state.whoseTurn(), DynamicTicTacToeState::PlayerId::ALICE);
+}
+
+TEST(DynamicTicTacToeState, Playout)
+{
+    // A game that is over is not played
+    DynamicBoard board(4, 5, 3);
+    board.set(0, 0, BoardCell::O);
+    board.set(0, 1, BoardCell::O);
+    board.set(0, 2, BoardCell::O);
+    board.set(1, 0, BoardCell::X);
+    board.set(1, 1, BoardCell::X);
+    DynamicTicTacToeState won(board, DynamicTicTacToeState::PlayerId::ALICE);
+    uint64_t              random = 1;
+    EXPECT_EQ(won.playout(&random), BoardCell::O);
+    EXPECT_EQ(random, 1u);
+
+    // The state is not changed and the result depends only on the random numbers
+    DynamicTicTacToeState state(DynamicBoard(5, 5, 4));
+    state.move(2, 2);
+    uint64_t fingerprint = state.fingerprint();
+    int      wins        = 0;
+    for (uint64_t seed = 0; seed < 100; ++seed)
+    {
+        uint64_t  random1 = seed;
+        uint64_t  random2 = seed;
+        BoardCell winner  = state.playout(&random1);
+        EXPECT_EQ(state.playout(&random2), winner);
+        EXPECT_EQ(random1, random2);
+        EXPECT_NE(random1, seed);
+        wins += (winner == BoardCell::X) ? 1 : 0;
+    }
+    EXPECT_EQ(state.fingerprint(), fingerprint);
+    EXPECT_EQ(state.numberOfMoves(), 1);
+    EXPECT_GT(wins, 0);
+}
+
+TEST(DynamicTicTacToeState, Fingerprint)
+{
+    // The same position reached in a different order has the same fingerprint
+    DynamicTicTacToeState a(DynamicBoard(4, 6, 4));
+    DynamicTicTacToeState b(DynamicBoard(4, 6, 4));
+    a.move(0, 0);
+    a.move(1, 1);
+    a.move(2, 2);
+    b.move(2, 2);
+    b.move(1, 1);
+    EXPECT_NE(a.fingerprint(), b.fingerprint()); // Different numbers of marks and players to move
+    b.move(0, 0);
+    EXPECT_EQ(a.fingerprint(), b.fingerprint());
+}
+} // namespace TicTacToe
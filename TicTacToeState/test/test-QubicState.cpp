@@ -0,0 +1,124 @@
+#include "gtest/gtest.h"
+
+#include "Components/Tables.h"
+#include "TicTacToeState/QubicState.h"
+#include "TicTacToeState/ZHash.h"
+
+namespace TicTacToe
+{
+TEST(QubicState, Constructor)
+{
+    QubicState state;
+    EXPECT_EQ(state.whoseTurn(), QubicState::PlayerId::ALICE);
+    EXPECT_FALSE(state.isDone());
+    EXPECT_EQ(state.winner(), BoardCell::NEITHER);
+    EXPECT_EQ(state.numberOfMoves(), 0);
+    EXPECT_FALSE(state.canUnmove());
+    EXPECT_EQ(state.lastMove().cell, BoardCell::NEITHER);
+    EXPECT_EQ(state.emptyMask(), QubicState::ALL);
+    EXPECT_EQ(state.fingerprint(), QubicZHash::EMPTY);
+
+    // A cube with a line through the center, which is already won
+    QubicState::Mask xs = (uint64_t(1) << 3) | (uint64_t(1) << 22) | (uint64_t(1) << 41) | (uint64_t(1) << 60);
+    QubicState::Mask os = (uint64_t(1) << 0) | (uint64_t(1) << 1) | (uint64_t(1) << 2);
+    QubicState       won(xs, os, QubicState::PlayerId::BOB);
+    EXPECT_TRUE(won.isDone());
+    EXPECT_EQ(won.winner(), BoardCell::X);
+    EXPECT_EQ(won.numberOfMoves(), 7);
+    EXPECT_EQ(won.at(1, 1, 2), BoardCell::X);
+    EXPECT_EQ(won.at(0, 0, 1), BoardCell::O);
+    EXPECT_EQ(won.fingerprint(), QubicZHash(xs, os, QubicState::PlayerId::BOB, true, BoardCell::X).value());
+}
+
+TEST(QubicState, MoveAndUnmove)
+{
+    QubicState state;
+    uint64_t   empty = state.fingerprint();
+
+    // X plays down the vertical line through (0, 0), and O plays along the top row of the second layer
+    for (int layer = 0; layer < 3; ++layer)
+    {
+        state.move(layer, 0, 0);
+        state.move(1, 3, layer);
+    }
+    EXPECT_EQ(state.numberOfMoves(), 6);
+    EXPECT_EQ(state.lastMove().cell, BoardCell::O);
+    EXPECT_EQ(state.lastMove().index, QubicState::toIndex(1, 3, 2));
+    EXPECT_EQ(state.threats(BoardCell::X), uint64_t(1) << QubicState::toIndex(3, 0, 0));
+    EXPECT_EQ(state.threats(BoardCell::O), uint64_t(1) << QubicState::toIndex(1, 3, 3));
+
+    uint64_t beforeWin = state.fingerprint();
+    state.move(3, 0, 0);
+    EXPECT_TRUE(state.isDone());
+    EXPECT_EQ(state.winner(), BoardCell::X);
+    EXPECT_EQ(state.fingerprint(), QubicZHash(state.mask(BoardCell::X), state.mask(BoardCell::O),
+                                              QubicState::PlayerId::BOB, true, BoardCell::X).value());
+
+    QubicState::MoveList moves;
+    state.generateMoves(&moves);
+    EXPECT_TRUE(moves.empty());
+
+    state.unmove();
+    EXPECT_FALSE(state.isDone());
+    EXPECT_EQ(state.winner(), BoardCell::NEITHER);
+    EXPECT_EQ(state.fingerprint(), beforeWin);
+    EXPECT_EQ(state.whoseTurn(), QubicState::PlayerId::ALICE);
+    EXPECT_EQ(state.lastMove().index, QubicState::toIndex(1, 3, 2));
+
+    state.generateMoves(&moves);
+    EXPECT_EQ(moves.size(), 58);
+    EXPECT_EQ(moves[0].index, 1);
+    EXPECT_EQ(moves[0].cell, BoardCell::X);
+
+    while (state.canUnmove())
+    {
+        state.unmove();
+    }
+    EXPECT_EQ(state.fingerprint(), empty);
+    EXPECT_EQ(state.numberOfMoves(), 0);
+    EXPECT_EQ(state.lastMove().cell, BoardCell::NEITHER);
+}
+
+TEST(QubicState, Fingerprint)
+{
+    // The same position reached in a different order has the same fingerprint
+    QubicState a;
+    QubicState b;
+    a.move(0);
+    a.move(21);
+    a.move(42);
+    b.move(42);
+    b.move(21);
+    EXPECT_NE(a.fingerprint(), b.fingerprint()); // Different numbers of marks and players to move
+    b.move(0);
+    EXPECT_EQ(a.fingerprint(), b.fingerprint());
+    EXPECT_EQ(a.fingerprint(), QubicZHash(a.mask(BoardCell::X), a.mask(BoardCell::O), a.whoseTurn()).value());
+}
+
+TEST(QubicState, Draw)
+{
+    // Filling the cube in a random order ends in a win or a draw, and the state always agrees with a check of all the lines
+    for (uint64_t seed = 0; seed < 20; ++seed)
+    {
+        QubicState state;
+        uint64_t   random = seed;
+        while (!state.isDone())
+        {
+            QubicState::MoveList moves;
+            state.generateMoves(&moves);
+            state.move(moves[static_cast<int>(Tables::splitMix64(random) % moves.size())].index);
+        }
+
+        bool xWins = false;
+        bool oWins = false;
+        for (QubicState::Mask line : QubicState::Geometry::LINES)
+        {
+            xWins = xWins || (state.mask(BoardCell::X) & line) == line;
+            oWins = oWins || (state.mask(BoardCell::O) & line) == line;
+        }
+        EXPECT_EQ(state.winner() == BoardCell::X, xWins);
+        EXPECT_EQ(state.winner() == BoardCell::O, oWins);
+        EXPECT_EQ(state.isDraw(), state.numberOfMoves() == QubicState::CELLS && !xWins && !oWins);
+    }
+}
+} // namespace TicTacToe
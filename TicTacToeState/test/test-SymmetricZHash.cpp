@@ -0,0 +1,77 @@
+#include "gtest/gtest.h"
+
+#include "TicTacToeState/SymmetricZHash.h"
+#include "TicTacToeState/TicTacToeState.h"
+#include "TicTacToeState/ZHash.h"
+
+namespace TicTacToe
+{
+Board boardAsymmetric({{
+                           Board::Cell::X,       Board::Cell::O,       Board::Cell::NEITHER,
+                           Board::Cell::NEITHER, Board::Cell::X,       Board::Cell::NEITHER,
+                           Board::Cell::NEITHER, Board::Cell::NEITHER, Board::Cell::O
+                       }});
+
+TEST(SymmetricZHash, Constructor)
+{
+    ASSERT_NO_THROW(SymmetricZHash());
+    ASSERT_NO_THROW(SymmetricZHash(Board(), TicTacToeState::PlayerId::ALICE));
+    EXPECT_EQ(SymmetricZHash().value(), ZHash::EMPTY);
+    EXPECT_EQ(SymmetricZHash(Board(), TicTacToeState::PlayerId::ALICE).value(), ZHash::EMPTY);
+}
+
+TEST(SymmetricZHash, Value_symmetry)
+{
+    // The value for each symmetry is the Zobrist hash of the transformed board
+    SymmetricZHash z(boardAsymmetric, TicTacToeState::PlayerId::ALICE);
+    for (int s = 0; s < Board::NUMBER_OF_SYMMETRIES; ++s)
+    {
+        EXPECT_EQ(z.value(s), ZHash(boardAsymmetric.transformed(s), TicTacToeState::PlayerId::ALICE).value());
+    }
+}
+
+TEST(SymmetricZHash, Value)
+{
+    // All symmetric forms have the same canonical value
+    SymmetricZHash z0(boardAsymmetric, TicTacToeState::PlayerId::BOB);
+    for (int s = 0; s < Board::NUMBER_OF_SYMMETRIES; ++s)
+    {
+        SymmetricZHash z(boardAsymmetric.transformed(s), TicTacToeState::PlayerId::BOB);
+        EXPECT_EQ(z.value(), z0.value());
+        EXPECT_LE(z.value(), z.value(s));
+    }
+}
+
+TEST(SymmetricZHash, Symmetry)
+{
+    // The symmetry transforms the board into its canonical form
+    SymmetricZHash z0(boardAsymmetric, TicTacToeState::PlayerId::ALICE);
+    Board canonical = boardAsymmetric.transformed(z0.symmetry());
+    for (int s = 0; s < Board::NUMBER_OF_SYMMETRIES; ++s)
+    {
+        Board          board = boardAsymmetric.transformed(s);
+        SymmetricZHash z(board, TicTacToeState::PlayerId::ALICE);
+        EXPECT_EQ(board.transformed(z.symmetry()).value(), canonical.value());
+    }
+}
+
+TEST(SymmetricZHash, Move_turn_done)
+{
+    // Incremental changes match a hash constructed from the final state
+    SymmetricZHash z;
+    Board          board;
+    for (int i : { 0, 4, 8 })
+    {
+        z.move(Board::Cell::X, i);
+        board.set(i, Board::Cell::X);
+    }
+    z.turn();
+    z.done(Board::Cell::X);
+    SymmetricZHash expected(board, TicTacToeState::PlayerId::BOB, true, Board::Cell::X);
+    for (int s = 0; s < Board::NUMBER_OF_SYMMETRIES; ++s)
+    {
+        EXPECT_EQ(z.value(s), expected.value(s));
+    }
+    EXPECT_EQ(z.value(), expected.value());
+}
+} // namespace TicTacToe
@@ -335,4 +335,376 @@ TEST(TicTacToeState, ToPlayerId)
     EXPECT_EQ(TicTacToeState::toPlayerId(Board::Cell::X).value(), TicTacToeState::PlayerId::ALICE);
     EXPECT_EQ(TicTacToeState::toPlayerId(Board::Cell::O).value(), TicTacToeState::PlayerId::BOB);
 }
+
+TEST(TicTacToeState, NumberOfMoves)
+{
+    EXPECT_EQ(TicTacToeState().numberOfMoves(), 0);
+    EXPECT_EQ(TicTacToeState(boardNotDone, TicTacToeState::PlayerId::ALICE).numberOfMoves(), 6);
+    EXPECT_EQ(TicTacToeState(boardDraw, TicTacToeState::PlayerId::BOB).numberOfMoves(), 9);
+
+    TicTacToeState state;
+    state.move(1, 1);
+    EXPECT_EQ(state.numberOfMoves(), 1);
+    state.move(0, 0);
+    EXPECT_EQ(state.numberOfMoves(), 2);
+}
+
+TEST(TicTacToeState, LineCount)
+{
+    TicTacToeState state(boardNotDone, TicTacToeState::PlayerId::ALICE);
+    for (int line = 0; line < 8; ++line)
+    {
+        Board::Mask mask = Board::LINES[line];
+        EXPECT_EQ(state.lineCount(line, Board::Cell::X), Board::count(boardNotDone.mask(Board::Cell::X) & mask));
+        EXPECT_EQ(state.lineCount(line, Board::Cell::O), Board::count(boardNotDone.mask(Board::Cell::O) & mask));
+        EXPECT_EQ(state.lineCount(line, Board::Cell::NEITHER), Board::count(boardNotDone.emptyMask() & mask));
+    }
+}
+
+TEST(TicTacToeState, TwoInLineCount)
+{
+    {
+        TicTacToeState state;
+        EXPECT_EQ(state.twoInLineCount(Board::Cell::X), 0);
+        EXPECT_EQ(state.twoInLineCount(Board::Cell::O), 0);
+    }
+    {
+        TicTacToeState state(boardNotDone, TicTacToeState::PlayerId::ALICE);
+        EXPECT_EQ(state.twoInLineCount(Board::Cell::X), 1); // Column 0
+        EXPECT_EQ(state.twoInLineCount(Board::Cell::O), 1); // Column 2
+    }
+}
+
+TEST(TicTacToeState, OpenLineCount)
+{
+    {
+        TicTacToeState state;
+        EXPECT_EQ(state.openLineCount(Board::Cell::X), 8);
+        EXPECT_EQ(state.openLineCount(Board::Cell::O), 8);
+
+        // X in the center blocks 4 of O's lines
+        state.move(1, 1);
+        EXPECT_EQ(state.openLineCount(Board::Cell::X), 8);
+        EXPECT_EQ(state.openLineCount(Board::Cell::O), 4);
+    }
+    {
+        TicTacToeState state(boardDraw, TicTacToeState::PlayerId::BOB);
+        EXPECT_EQ(state.openLineCount(Board::Cell::X), 0);
+        EXPECT_EQ(state.openLineCount(Board::Cell::O), 0);
+    }
+}
+
+// Plays every game from the given state and checks the incrementally-maintained status against a state constructed from
+// the same board.
+static void ValidateIncrementalStatus(TicTacToeState const & state)
+{
+    TicTacToeState expected(state.board(), state.whoseTurn());
+    ASSERT_EQ(state.isDone(), expected.isDone());
+    ASSERT_EQ(state.winner(), expected.winner());
+    ASSERT_EQ(state.numberOfMoves(), expected.numberOfMoves());
+    ASSERT_EQ(state.fingerprint(), expected.fingerprint());
+    ASSERT_EQ(state.rank(), expected.rank());
+    ASSERT_EQ(state.rank(), state.board().rank());
+    for (Board::Cell cell : { Board::Cell::X, Board::Cell::O })
+    {
+        ASSERT_EQ(state.twoInLineCount(cell), expected.twoInLineCount(cell));
+        ASSERT_EQ(state.openLineCount(cell), expected.openLineCount(cell));
+        for (int line = 0; line < 8; ++line)
+        {
+            ASSERT_EQ(state.lineCount(line, cell), expected.lineCount(line, cell));
+        }
+    }
+
+    if (state.isDone())
+        return;
+
+    for (int i = 0; i < 9; ++i)
+    {
+        if (state.board().at(i) == Board::Cell::NEITHER)
+        {
+            TicTacToeState child(state);
+            auto [r, c] = Board::toPosition(i);
+            child.move(r, c);
+            ValidateIncrementalStatus(child);
+        }
+    }
+}
+
+TEST(TicTacToeState, IncrementalStatus)
+{
+    ValidateIncrementalStatus(TicTacToeState());
+}
+// Returns true if the observable parts of two states are the same
+static bool SameState(TicTacToeState const & a, TicTacToeState const & b)
+{
+    bool same = a.board().value() == b.board().value() &&
+                a.whoseTurn() == b.whoseTurn() &&
+                a.isDone() == b.isDone() &&
+                a.winner() == b.winner() &&
+                a.fingerprint() == b.fingerprint() &&
+                a.rank() == b.rank() &&
+                a.numberOfMoves() == b.numberOfMoves() &&
+                a.canUnmove() == b.canUnmove() &&
+                a.lastMove().cell == b.lastMove().cell &&
+                a.lastMove().row == b.lastMove().row &&
+                a.lastMove().column == b.lastMove().column;
+    for (Board::Cell cell : { Board::Cell::X, Board::Cell::O })
+    {
+        same = same &&
+               a.twoInLineCount(cell) == b.twoInLineCount(cell) &&
+               a.openLineCount(cell) == b.openLineCount(cell);
+    }
+    return same;
+}
+
+// Makes and unmakes every move in the game tree, checking that each unmove restores the state
+static void ValidateUnmove(TicTacToeState & state)
+{
+    if (state.isDone())
+        return;
+
+    for (int i = 0; i < 9; ++i)
+    {
+        if (state.board().at(i) == Board::Cell::NEITHER)
+        {
+            TicTacToeState before(state);
+            auto [r, c] = Board::toPosition(i);
+            state.move(r, c);
+            ASSERT_TRUE(state.canUnmove());
+            ValidateUnmove(state);
+            state.unmove();
+            ASSERT_TRUE(SameState(state, before));
+        }
+    }
+}
+
+TEST(TicTacToeState, Unmove)
+{
+    {
+        TicTacToeState state;
+        EXPECT_FALSE(state.canUnmove());
+        ValidateUnmove(state);
+        EXPECT_TRUE(SameState(state, TicTacToeState()));
+    }
+    {
+        // The canonical fingerprint is restored too
+        TicTacToeState state;
+        state.useCanonicalFingerprint(true);
+        ValidateUnmove(state);
+        EXPECT_EQ(state.fingerprint(), TicTacToeState().fingerprint());
+    }
+    {
+        // Winning and drawing moves are undone, including the game status
+        TicTacToeState state(boardDrawNext, TicTacToeState::PlayerId::ALICE);
+        EXPECT_FALSE(state.canUnmove());
+        TicTacToeState before(state);
+        state.move(2, 2);
+        EXPECT_TRUE(state.isDraw());
+        state.unmove();
+        EXPECT_TRUE(SameState(state, before));
+        EXPECT_FALSE(state.canUnmove());
+    }
+}
+
+TEST(TicTacToeState, Rank)
+{
+    EXPECT_EQ(TicTacToeState().rank(), 0);
+    EXPECT_EQ(TicTacToeState(boardNotDone, TicTacToeState::PlayerId::ALICE).rank(), boardNotDone.rank());
+
+    TicTacToeState state;
+    state.move(1, 1);
+    EXPECT_EQ(state.rank(), Board::rankOf(Board::Cell::X, 4));
+    state.move(0, 2);
+    EXPECT_EQ(state.rank(), Board::rankOf(Board::Cell::X, 4) + Board::rankOf(Board::Cell::O, 2));
+    state.unmove();
+    EXPECT_EQ(state.rank(), Board::rankOf(Board::Cell::X, 4));
+}
+
+TEST(TicTacToeState, CanonicalFingerprint)
+{
+    TicTacToeState state;
+    EXPECT_FALSE(state.usesCanonicalFingerprint());
+    state.move(0, 0);
+    state.move(0, 1);
+
+    // Enabling canonical fingerprints gives the same fingerprint to every symmetric form of the state
+    TicTacToeState canonical(state);
+    canonical.useCanonicalFingerprint(true);
+    EXPECT_TRUE(canonical.usesCanonicalFingerprint());
+    for (int s = 0; s < Board::NUMBER_OF_SYMMETRIES; ++s)
+    {
+        TicTacToeState symmetric(state.board().transformed(s), state.whoseTurn());
+        symmetric.useCanonicalFingerprint(true);
+        EXPECT_EQ(symmetric.fingerprint(), canonical.fingerprint());
+
+        // The canonical symmetry maps each form to the same board
+        EXPECT_EQ(symmetric.board().transformed(symmetric.canonicalSymmetry()).value(),
+                  canonical.board().transformed(canonical.canonicalSymmetry()).value());
+    }
+
+    // The canonical fingerprint is maintained through move() and unmove() and is inherited by copies
+    TicTacToeState copy(canonical);
+    EXPECT_TRUE(copy.usesCanonicalFingerprint());
+    copy.move(2, 2);
+    TicTacToeState expected(copy.board(), copy.whoseTurn());
+    expected.useCanonicalFingerprint(true);
+    EXPECT_EQ(copy.fingerprint(), expected.fingerprint());
+    copy.unmove();
+    EXPECT_EQ(copy.fingerprint(), canonical.fingerprint());
+
+    // Disabling returns to the ordinary fingerprint
+    canonical.useCanonicalFingerprint(false);
+    EXPECT_EQ(canonical.fingerprint(), state.fingerprint());
+}
+
+TEST(TicTacToeState, MoveList)
+{
+    TicTacToeState::MoveList moves;
+    EXPECT_TRUE(moves.empty());
+    EXPECT_EQ(moves.size(), 0);
+
+    for (int i = 0; i < TicTacToeState::MoveList::CAPACITY; ++i)
+    {
+        auto [r, c] = Board::toPosition(i);
+        moves.push_back({ Board::Cell::X, r, c });
+        EXPECT_EQ(moves.size(), i + 1);
+        EXPECT_EQ(moves[i].row, r);
+        EXPECT_EQ(moves[i].column, c);
+    }
+    EXPECT_FALSE(moves.empty());
+    EXPECT_EQ(moves.end() - moves.begin(), TicTacToeState::MoveList::CAPACITY);
+
+    moves.clear();
+    EXPECT_TRUE(moves.empty());
+}
+
+TEST(TicTacToeState, GenerateMoves)
+{
+    TicTacToeState::MoveList moves;
+    {
+        TicTacToeState state;
+        state.generateMoves(&moves);
+        ASSERT_EQ(moves.size(), 9);
+        for (int i = 0; i < 9; ++i)
+        {
+            EXPECT_EQ(moves[i].cell, Board::Cell::X);
+            EXPECT_EQ(Board::toIndex(moves[i].row, moves[i].column), i);
+        }
+    }
+    {
+        // Only the empty cells, in index order, for the player to move
+        TicTacToeState state(boardNotDone, TicTacToeState::PlayerId::BOB);
+        state.generateMoves(&moves);
+        ASSERT_EQ(moves.size(), 3);
+        EXPECT_EQ(Board::toIndex(moves[0].row, moves[0].column), 3);
+        EXPECT_EQ(Board::toIndex(moves[1].row, moves[1].column), 5);
+        EXPECT_EQ(Board::toIndex(moves[2].row, moves[2].column), 7);
+        for (auto const & move : moves)
+        {
+            EXPECT_EQ(move.cell, Board::Cell::O);
+        }
+    }
+    {
+        // No moves when the game is over, even if there are empty cells
+        TicTacToeState state(boardXWins, TicTacToeState::PlayerId::BOB);
+        state.generateMoves(&moves);
+        EXPECT_TRUE(moves.empty());
+    }
+}
+
+TEST(TicTacToeState, Playout)
+{
+    {
+        // A game that is over is not played
+        TicTacToeState state(boardXWins, TicTacToeState::PlayerId::BOB);
+        uint64_t       random = 1;
+        EXPECT_EQ(state.playout(&random), Board::Cell::X);
+        EXPECT_EQ(random, 1u);
+    }
+    {
+        // The state is not changed and the result depends only on the random numbers
+        TicTacToeState state(boardNotDone, TicTacToeState::PlayerId::BOB);
+        uint64_t       fingerprint = state.fingerprint();
+        for (uint64_t seed = 0; seed < 100; ++seed)
+        {
+            uint64_t random1 = seed;
+            uint64_t random2 = seed;
+            EXPECT_EQ(state.playout(&random1), state.playout(&random2));
+            EXPECT_EQ(random1, random2);
+            EXPECT_NE(random1, seed);
+        }
+        EXPECT_EQ(state.fingerprint(), fingerprint);
+        EXPECT_EQ(state.numberOfMoves(), 6);
+    }
+    {
+        // With random play from the start, X wins about 58.5% of the games, O wins about 28.8%, and 12.7% are draws
+        TicTacToeState state;
+        uint64_t       random = 0;
+        int            counts[3] = {};
+        int constexpr  PLAYOUTS  = 100000;
+        for (int i = 0; i < PLAYOUTS; ++i)
+        {
+            ++counts[static_cast<int>(state.playout(&random))];
+        }
+        EXPECT_NEAR(double(counts[static_cast<int>(Board::Cell::X)]) / PLAYOUTS, 0.585, 0.01);
+        EXPECT_NEAR(double(counts[static_cast<int>(Board::Cell::O)]) / PLAYOUTS, 0.288, 0.01);
+        EXPECT_NEAR(double(counts[static_cast<int>(Board::Cell::NEITHER)]) / PLAYOUTS, 0.127, 0.01);
+    }
+}
+
+TEST(TicTacToeState, Sizes)
+{
+    {
+        // 4 in a row wins on a 4x4 board
+        using State = BasicTicTacToeState<4, 4, 4>;
+        State state;
+        EXPECT_EQ(State::NUMBER_OF_INDEXES, 2 * 43046721);
+        for (int c = 0; c < 3; ++c)
+        {
+            state.move(0, c); // X
+            state.move(1, c); // O
+        }
+        EXPECT_EQ(state.twoInLineCount(BoardCell::X), 1);
+        EXPECT_EQ(state.lineCount(0, BoardCell::NEITHER), 1);
+        EXPECT_FALSE(state.isDone());
+        state.move(0, 3);
+        EXPECT_TRUE(state.isDone());
+        EXPECT_EQ(state.winner(), BoardCell::X);
+        EXPECT_EQ(state.rank(), state.board().rank());
+        state.unmove();
+        EXPECT_FALSE(state.isDone());
+
+        State::MoveList moves;
+        state.generateMoves(&moves);
+        EXPECT_EQ(moves.size(), 10);
+    }
+    {
+        // A 7x7 board has no ranks, but play, hashing and playouts work
+        using State = BasicTicTacToeState<7, 7, 4>;
+        State state;
+        state.useCanonicalFingerprint(true);
+        uint64_t fingerprint = state.fingerprint();
+        for (int r = 0; r < 3; ++r)
+        {
+            state.move(r + 3, 6); // X
+            state.move(r, 0);     // O
+        }
+        EXPECT_EQ(state.numberOfMoves(), 6);
+        state.move(6, 6);
+        EXPECT_EQ(state.winner(), BoardCell::X);
+        for (int i = 0; i < 7; ++i)
+        {
+            state.unmove();
+        }
+        EXPECT_EQ(state.fingerprint(), fingerprint);
+
+        uint64_t random = 0;
+        for (int i = 0; i < 100; ++i)
+        {
+            BoardCell winner = state.playout(&random);
+            EXPECT_TRUE(winner == BoardCell::X || winner == BoardCell::O || winner == BoardCell::NEITHER);
+        }
+        EXPECT_EQ(state.numberOfMoves(), 0);
+    }
+}
 } // namespace TicTacToe
@@ -1,19 +1,23 @@
 #include "Window.h"
 
-#include "TicTacToeState/TicTacToeState.h"
-
 #define _USE_MATH_DEFINES 1
+#include <algorithm>
 #include <iostream>
 #include <math.h>
 
-Window::Window(int width, int height)
+// Space left around the grid
+static int const MARGIN = 30;
+
+Window::Window(int rows, int columns, int width, int height)
     : window_(nullptr)
     , renderer_(nullptr)
+    , rows_(rows)
+    , columns_(columns)
     , width_(width)
     , height_(height)
-    , cellSize_(std::min(width, height) / 3 - 20)
-    , boardOffsetX_((width - cellSize_ * 3) / 2)
-    , boardOffsetY_((height - cellSize_ * 3) / 2)
+    , cellSize_(std::min((width - 2 * MARGIN) / columns, (height - 2 * MARGIN) / rows))
+    , boardOffsetX_((width - cellSize_ * columns) / 2)
+    , boardOffsetY_((height - cellSize_ * rows) / 2)
 {
     if (!SDL_Init(SDL_INIT_VIDEO))
     {
@@ -57,27 +61,8 @@ void Window::clear()
     SDL_RenderClear(renderer_);
 }
 
-void Window::render(TicTacToeState const & state)
+void Window::present()
 {
-    clear();
-    drawGrid();
-
-    Board const & board = state.board();
-    for (int row = 0; row < 3; ++row)
-    {
-        for (int col = 0; col < 3; ++col)
-        {
-            Board::Cell cell = board.at(row, col);
-            if (cell == Board::Cell::X)
-            {
-                drawX(row, col);
-            }
-            else if (cell == Board::Cell::O)
-            {
-                drawO(row, col);
-            }
-        }
-    }
     SDL_RenderPresent(renderer_);
 }
 
@@ -86,24 +71,24 @@ void Window::drawGrid()
     SDL_SetRenderDrawColor(renderer_, 0, 0, 0, 255); // Black lines
 
     // Vertical lines
-    for (int i = 1; i < 3; ++i)
+    for (int i = 1; i < columns_; ++i)
     {
         int x = boardOffsetX_ + i * cellSize_;
-        SDL_RenderLine(renderer_, x, boardOffsetY_, x, boardOffsetY_ + 3 * cellSize_);
+        SDL_RenderLine(renderer_, x, boardOffsetY_, x, boardOffsetY_ + rows_ * cellSize_);
     }
 
     // Horizontal lines
-    for (int i = 1; i < 3; ++i)
+    for (int i = 1; i < rows_; ++i)
     {
         int y = boardOffsetY_ + i * cellSize_;
-        SDL_RenderLine(renderer_, boardOffsetX_, y, boardOffsetX_ + 3 * cellSize_, y);
+        SDL_RenderLine(renderer_, boardOffsetX_, y, boardOffsetX_ + columns_ * cellSize_, y);
     }
 
     // Border
     SDL_FRect border = {static_cast<float>(boardOffsetX_),
                         static_cast<float>(boardOffsetY_),
-                        static_cast<float>(3 * cellSize_),
-                        static_cast<float>(3 * cellSize_)};
+                        static_cast<float>(columns_ * cellSize_),
+                        static_cast<float>(rows_ * cellSize_)};
     SDL_RenderRect(renderer_, &border);
 }
 
@@ -111,9 +96,10 @@ void Window::drawX(int row, int col)
 {
     SDL_SetRenderDrawColor(renderer_, 255, 0, 0, 255); // Red X
 
-    int x    = boardOffsetX_ + col * cellSize_ + 10;
-    int y    = boardOffsetY_ + row * cellSize_ + 10;
-    int size = cellSize_ - 20;
+    int pad  = cellSize_ / 18; // Scaled so that the marks look the same on any size of board
+    int x    = boardOffsetX_ + col * cellSize_ + pad;
+    int y    = boardOffsetY_ + row * cellSize_ + pad;
+    int size = cellSize_ - 2 * pad;
 
     // Draw X as two diagonal lines
     SDL_RenderLine(renderer_, x, y, x + size, y + size);
@@ -126,7 +112,7 @@ void Window::drawO(int row, int col)
 
     int centerX = boardOffsetX_ + col * cellSize_ + cellSize_ / 2;
     int centerY = boardOffsetY_ + row * cellSize_ + cellSize_ / 2;
-    int radius  = cellSize_ / 2 - 15;
+    int radius  = cellSize_ / 2 - cellSize_ / 12;
 
     // Draw circle (simplified - draw as octagon)
     int const points = 32;
@@ -150,8 +136,8 @@ std::pair<int, int> Window::screenToBoard(int x, int y) const
     int row = (y - boardOffsetY_) / cellSize_;
 
     // Clamp to valid range
-    col = std::max(0, std::min(2, col));
-    row = std::max(0, std::min(2, row));
+    col = std::max(0, std::min(columns_ - 1, col));
+    row = std::max(0, std::min(rows_ - 1, row));
 
     return {row, col};
 }
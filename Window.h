@@ -1,17 +1,43 @@
 #pragma once
 
+#include "Components/Board.h"
+
 #include <SDL3/SDL.h>
 #include <memory>
 
-class TicTacToeState;
-
 class Window
 {
 public:
-    Window(int width = 600, int height = 600);
+    // Constructor. The grid is laid out for a board with the specified number of rows and columns.
+    Window(int rows = 3, int columns = 3, int width = 600, int height = 600);
     ~Window();
 
-    void render(const TicTacToeState & state);
+    // Draws the board of a state. The state can be any tic-tac-toe state whose board is the size of the grid.
+    template <typename State>
+    void render(State const & state)
+    {
+        clear();
+        drawGrid();
+
+        auto const & board = state.board();
+        for (int row = 0; row < rows_; ++row)
+        {
+            for (int col = 0; col < columns_; ++col)
+            {
+                BoardCell cell = board.at(row, col);
+                if (cell == BoardCell::X)
+                {
+                    drawX(row, col);
+                }
+                else if (cell == BoardCell::O)
+                {
+                    drawO(row, col);
+                }
+            }
+        }
+        present();
+    }
+
     void clear();
     SDL_Window * window() const { return window_; }
 
@@ -21,12 +47,15 @@ public:
 private:
     SDL_Window *   window_;
     SDL_Renderer * renderer_;
+    int            rows_;
+    int            columns_;
     int            width_;
     int            height_;
     int            cellSize_;
     int            boardOffsetX_;
     int            boardOffsetY_;
 
+    void present();
     void drawGrid();
     void drawX(int row, int col);
     void drawO(int row, int col);
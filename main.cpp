@@ -1,6 +1,7 @@
 #include "Game.h"
 #include "Window.h"
 
+#include "Components/DynamicBoard.h"
 #include "ComputerPlayer/ComputerPlayer.h"
 #include "TicTacToeState/TicTacToeState.h"
 
@@ -12,6 +13,8 @@
 
 #include <cassert>
 #include <iostream>
+#include <map>
+#include <string>
 
 using namespace GamePlayer;
 
@@ -21,8 +24,18 @@ static std::unique_ptr<Game> g_game;
 // Command line option to determine who goes first
 static bool g_humanGoesFirst = true;
 
-// Function to parse command line arguments
-static int parseCommandLine(int argc, char * argv[])
+// Command line option to choose the computer's search engine
+static Game::Engine g_engine = Game::Engine::MINIMAX;
+
+// Command line option to choose the tablebase file used by the tablebase engine
+static std::string g_tablebase = "tictactoe.tb";
+
+// Command line options to choose the size of the board and the number of marks in a line needed to win
+static Game::Size g_size;
+
+// Function to parse command line arguments. Returns SDL_APP_CONTINUE if the game should start. Otherwise, the message for
+// help or for an invalid option has been printed, and the result is how the app should exit.
+static SDL_AppResult parseCommandLine(int argc, char * argv[])
 {
     CLI::App cli;
     bool     first  = false;
@@ -33,7 +46,34 @@ static int parseCommandLine(int argc, char * argv[])
     order->add_flag("--second, -s", second, "The computer goes first.");
     order->require_option(0, 1);
 
-    CLI11_PARSE(cli, argc, argv);
+    std::map<std::string, Game::Engine> const engines = {
+        { "minimax", Game::Engine::MINIMAX },
+        { "negamax", Game::Engine::NEGAMAX },
+        { "mcts", Game::Engine::MCTS },
+        { "tablebase", Game::Engine::TABLEBASE }
+    };
+    cli.add_option("--engine, -e", g_engine, "The computer's search engine: minimax (default), negamax, mcts or tablebase.")
+        ->transform(CLI::CheckedTransformer(engines, CLI::ignore_case));
+    cli.add_option("--tablebase, -t", g_tablebase, "The tablebase file used by the tablebase engine.")
+        ->capture_default_str();
+    cli.add_option("--rows, -r", g_size.rows, "The number of rows of the board.")
+        ->check(CLI::Range(1, DynamicBoard::MAX_SIZE))
+        ->capture_default_str();
+    cli.add_option("--columns, --cols, -c", g_size.columns, "The number of columns of the board.")
+        ->check(CLI::Range(1, DynamicBoard::MAX_SIZE))
+        ->capture_default_str();
+    cli.add_option("--k, -k", g_size.k, "The number of marks in a line needed to win.")
+        ->check(CLI::Range(1, DynamicBoard::MAX_SIZE))
+        ->capture_default_str();
+
+    try
+    {
+        cli.parse(argc, argv);
+    }
+    catch (CLI::ParseError const & e)
+    {
+        return (cli.exit(e) == 0) ? SDL_APP_SUCCESS : SDL_APP_FAILURE; // Help succeeds, and anything else fails
+    }
 
     if (first)
     {
@@ -44,17 +84,21 @@ static int parseCommandLine(int argc, char * argv[])
         g_humanGoesFirst = false;
     }
 
-    return 0;
+    return SDL_APP_CONTINUE;
 }
 
 // SDL3 main callback functions
 static SDL_AppResult SDL_AppInit(void ** appstate, int argc, char * argv[])
 {
-    parseCommandLine(argc, argv);
+    SDL_AppResult parsed = parseCommandLine(argc, argv);
+    if (parsed != SDL_APP_CONTINUE)
+    {
+        return parsed;
+    }
 
     try
     {
-        g_game = std::make_unique<Game>(g_humanGoesFirst);
+        g_game = Game::create(g_humanGoesFirst, g_size, g_engine, g_tablebase);
     }
     catch (const std::exception & e)
     {